@@ -0,0 +1,142 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file BatchRedTail.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c BatchRedTail.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_BatchRedTail_h_
+#define polybori_groebner_BatchRedTail_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+
+#include "ReductionStrategy.h"
+#include "ReductionTerms.h"
+#include "add_up.h"
+
+#include <unordered_map>
+#include <vector>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class BatchRedTail
+ * @brief This class applies tail reduction to a batch of elements of a given
+ * @c ReductionStrategy at once.
+ *
+ * The reducible terms of all tails are collected in a single diagram and the
+ * normal form of each distinct term is computed only once: since normal forms
+ * are linear, the reduced tail is the irreducible part of the tail plus the
+ * normal forms of its reducible terms. The normal form of a term is built from
+ * its head normal form, whose (smaller) reducible terms are resolved and
+ * cached the same way. Hence, the result does not depend on the order of the
+ * elements.
+ *
+ * @note The elements must form a Groebner basis, such that normal forms are
+ * unique.
+ **/
+class BatchRedTail {
+public:
+  BatchRedTail(ReductionStrategy& strat):
+    m_strat(strat), m_normal_forms() {}
+
+  /// Tail reduce the elements with given keys (result in the same order)
+  template <class Iterator>
+  std::vector<Polynomial> operator()(Iterator start, Iterator finish) {
+
+    std::vector<Polynomial> result;
+    for (; start != finish; ++start)
+      result.push_back(m_strat[*start].p);
+
+    MonomialSet tails(m_strat.leadingTerms.ring());
+    for (std::size_t idx = 0; idx < result.size(); ++idx)
+      tails = tails.unite(tail(result[idx]));
+
+    MonomialSet reducible = tails.diff(irreducible(tails));
+    if (reducible.isZero())
+      return result;
+
+    for (MonomialSet::const_iterator iter = reducible.begin();
+         iter != reducible.end(); ++iter)
+      normalForm(*iter);
+
+    for (std::size_t idx = 0; idx < result.size(); ++idx) {
+      MonomialSet terms = tail(result[idx]).intersect(reducible);
+      if (!terms.isZero()) {
+        Polynomial& poly = result[idx];
+        std::vector<Polynomial> summands(1, poly.diagram().diff(terms));
+        for (MonomialSet::const_iterator iter = terms.begin();
+             iter != terms.end(); ++iter)
+          summands.push_back(m_normal_forms.find(*iter)->second);
+        poly = add_up_polynomials(summands, poly.ring().zero());
+        m_strat(poly.leadExp()) = poly;
+      }
+    }
+    return result;
+  }
+
+protected:
+  typedef std::unordered_map<Monomial, Polynomial, hashes<Monomial> >
+  map_type;
+
+  /// Terms of p except for the leading one
+  static MonomialSet tail(const Polynomial& p) {
+    return p.diagram().diff(p.lead().diagram());
+  }
+
+  /// Terms not divisible by any leading term
+  MonomialSet irreducible(const MonomialSet& terms) const {
+    return mod_mon_set(terms, m_strat.minimalLeadingTerms);
+  }
+
+  /// Compute and cache normal form of term (and the terms it depends on)
+  void normalForm(const Monomial& term) {
+    std::vector<std::pair<Monomial, Polynomial> > stack;
+    stack.push_back(std::make_pair(term, m_strat.headNormalForm(term)));
+
+    // depth-first, the terms of a head normal form are smaller than the term
+    while (!stack.empty()) {
+      if (m_normal_forms.find(stack.back().first) != m_normal_forms.end()) {
+        stack.pop_back();
+        continue;
+      }
+
+      const Polynomial head = stack.back().second;
+      MonomialSet terms = head.diagram().diff(irreducible(head.diagram()));
+
+      bool complete = true;
+      for (MonomialSet::const_iterator iter = terms.begin();
+           iter != terms.end(); ++iter)
+        if (m_normal_forms.find(*iter) == m_normal_forms.end()) {
+          stack.push_back(std::make_pair(*iter, m_strat.headNormalForm(*iter)));
+          complete = false;
+        }
+
+      if (complete) {
+        std::vector<Polynomial> summands(1, head.diagram().diff(terms));
+        for (MonomialSet::const_iterator iter = terms.begin();
+             iter != terms.end(); ++iter)
+          summands.push_back(m_normal_forms.find(*iter)->second);
+        m_normal_forms.insert(std::make_pair(stack.back().first,
+          add_up_polynomials(summands, head.ring().zero())));
+        stack.pop_back();
+      }
+    }
+  }
+
+private:
+  ReductionStrategy& m_strat;
+  map_type m_normal_forms;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_BatchRedTail_h_ */
@@ -0,0 +1,93 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file BinomialReductors.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c BinomialReductors.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_BinomialReductors_h_
+#define polybori_groebner_BinomialReductors_h_
+
+#include "PolyEntry.h"
+#include "LLReductor.h"
+
+// include basic definitions
+#include "groebner_defs.h"
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class BinomialReductors
+ * @brief This class collects generators of the shapes @f$m + 1@f$,
+ * @f$x y + x@f$ and @f$x + y@f$ for @c binomial_nf.
+ *
+ * The leading terms @f$m@f$ of the generators @f$m + 1@f$ are stored in
+ * @c plusOne() (for @c plug_1). A generator @f$x y + x@f$ means that @f$y@f$
+ * may be dropped from all terms containing @f$x@f$. The leading terms
+ * @f$x y@f$ are stored in @c keptFirst(), if the kept variable @f$x@f$ has the
+ * smaller index, and in @c keptSecond() otherwise. Generators @f$x + y@f$ with linear leading term
+ * on top are collected in @c linear() for @c ll_red_nf.
+ *
+ * @note Like the other terms of @c ReductionTerms, the data is not
+ * updated, if generators are exchanged (the old ones stay valid reductors).
+ **/
+class BinomialReductors {
+  typedef BinomialReductors self;
+
+public:
+  BinomialReductors(const BoolePolyRing& ring):
+    m_plus_one(ring), m_kept_first(ring), m_kept_second(ring), m_linear(ring),
+    m_count(0) {}
+
+  /// Insert data from entry, if it is a binomial of the shapes above
+  void update(const PolyEntry& entry) {
+    if (entry.length != 2)
+      return;
+
+    if (entry.p.hasConstantPart()) {
+      m_plus_one = m_plus_one.unite(entry.lead.set());
+      ++m_count;
+    }
+    else if (entry.leadDeg == 1) {
+      if (m_linear.isCompatible(entry)) {
+        m_linear.update(entry);
+        ++m_count;
+      }
+    }
+    else if (entry.leadDeg == 2) {
+      Monomial tail = entry.tail.lead();
+      if ((tail.deg() == 1) && entry.lead.reducibleBy(tail)) {
+        idx_type kept = *tail.begin();
+        if (kept == *entry.lead.begin())
+          m_kept_first = m_kept_first.unite(entry.lead.set());
+        else
+          m_kept_second = m_kept_second.unite(entry.lead.set());
+        ++m_count;
+      }
+    }
+  }
+
+  /// Check, whether binomials make up most of the generators
+  bool dominant(std::size_t size) const { return 2 * m_count > size; }
+
+  const MonomialSet& plusOne() const { return m_plus_one; }
+  const MonomialSet& keptFirst() const { return m_kept_first; }
+  const MonomialSet& keptSecond() const { return m_kept_second; }
+  const LLReductor& linear() const { return m_linear; }
+
+private:
+  MonomialSet m_plus_one, m_kept_first, m_kept_second;
+  LLReductor m_linear;
+  std::size_t m_count;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_BinomialReductors_h_ */
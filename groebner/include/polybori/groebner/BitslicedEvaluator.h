@@ -0,0 +1,135 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file BitslicedEvaluator.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c BitslicedEvaluator.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_BitslicedEvaluator_h_
+#define polybori_groebner_BitslicedEvaluator_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class BitslicedEvaluator
+ * @brief This class compiles (systems of) polynomials to a straight-line
+ * program, which evaluates them at many points at once.
+ *
+ * Each node of the decision diagrams of the polynomials p = x*p1 + p0
+ * becomes an instruction r = (x & r1) ^ r0 operating on lanes of
+ * @c lane_bits points, such that each bit of a register belongs to a
+ * different point. Subdiagrams shared within and between the polynomials
+ * are computed once and registers are reused after their last use. Lanes are
+ * fixed arrays of machine words, which the compiler vectorizes to the widest
+ * available instructions. The program can also be written as C source code
+ * via @c writeC.
+ *
+ * Unlike @c zeros, which uses the structure of the candidate set, the costs
+ * are linear in the number of points. Hence, it is meant for large
+ * unstructured candidate sets, which are distributed over several threads.
+ **/
+class BitslicedEvaluator {
+  typedef BitslicedEvaluator self;
+
+public:
+  typedef unsigned long long word_type;
+  typedef std::vector<word_type> bitmap_type;
+  typedef std::size_t size_type;
+
+  enum {
+    word_bits = sizeof(word_type) * 8,
+    lane_words = 8,
+    lane_bits = lane_words * word_bits,
+    /// Minimal number of lanes per thread
+    parallel_cutoff = 64
+  };
+
+  /// Register holding the bits of lane_bits points
+  struct lane_type {
+    word_type words[lane_words];
+  };
+
+  /// Instruction dst = (var & then_reg) ^ else_reg
+  struct instruction_type {
+    unsigned dst, var, then_reg, else_reg;
+  };
+
+  /// Registers of the constants and first register of the variables
+  enum { zero_reg = 0, one_reg = 1, input_reg = 2 };
+
+  /// Compile poly
+  BitslicedEvaluator(const Polynomial& poly);
+
+  /// Compile the system polys (which must not be empty)
+  BitslicedEvaluator(const std::vector<Polynomial>& polys);
+
+  /// Number of instructions
+  size_type size() const { return m_program.size(); }
+
+  /// Number of compiled polynomials
+  size_type nOutputs() const { return m_results.size(); }
+
+  /// Number of registers needed per lane (constants and inputs included)
+  size_type nRegisters() const { return m_nregisters; }
+
+  /// Bit i is set iff all polynomials vanish at the i-th point of
+  /// candidates, using nthreads threads (0: choose by hardware and size)
+  bitmap_type zeroBitmap(const MonomialSet& candidates,
+                         unsigned nthreads = 0) const;
+
+  /// Points of candidates, at which all polynomials vanish
+  MonomialSet zeros(const MonomialSet& candidates,
+                    unsigned nthreads = 0) const;
+
+  /// Bit i of the j-th bitmap is the value of the j-th polynomial at
+  /// points[i] (the exponent of the variables set to one)
+  std::vector<bitmap_type> values(const std::vector<Exponent>& points,
+                                  unsigned nthreads = 0) const;
+
+  /// Write C function void name(const uint64_t* x, uint64_t* y), which sets
+  /// y[j] to the value of the j-th polynomial on 64 points, whose bits of
+  /// the variable with index i are given by x[i]
+  void writeC(std::ostream& os, const std::string& name) const;
+
+protected:
+  /// Run program on registers (whose inputs have been set)
+  void run(lane_type* regs) const;
+
+  /// Set inputs to points[start, start + lane_bits) and run program
+  void evaluateLane(const std::vector<Exponent>& points, size_type start,
+                    lane_type* regs) const;
+
+  /// Call op(lane, regs) for each lane of npoints points on nthreads threads
+  template <class Operation>
+  void forEachLane(size_type npoints, unsigned nthreads,
+                   const Operation& op) const;
+
+  /// Setup program for polys
+  void compile(const std::vector<Polynomial>& polys);
+
+private:
+  BoolePolyRing m_ring;
+  std::vector<instruction_type> m_program;
+  /// Input register of each variable (zero_reg for unused ones)
+  std::vector<unsigned> m_input_of;
+  size_type m_ninputs, m_nregisters;
+  std::vector<unsigned> m_results;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_BitslicedEvaluator_h_ */
@@ -0,0 +1,72 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file CopyOnWrite.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class template @c CopyOnWrite.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_CopyOnWrite_h_
+#define polybori_groebner_CopyOnWrite_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+#include <memory>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class CopyOnWrite
+ * @brief This class template shares its value among copies until one of
+ * them is modified.
+ *
+ * Copying is O(1), the (first) call of @c mutate() on a shared value clones
+ * it. Nesting, e.g. a @c CopyOnWrite of a vector of @c CopyOnWrite elements,
+ * limits the cloning to the pointer vector and the elements actually changed.
+ *
+ * @note References obtained by @c mutate() must not be kept over a copy.
+ **/
+template <class ValueType>
+class CopyOnWrite {
+  typedef CopyOnWrite self;
+
+public:
+  typedef ValueType value_type;
+  typedef ValueType element_type;
+  typedef std::shared_ptr<value_type> pointer_type;
+
+  /// Default constructor
+  CopyOnWrite(): m_data(std::make_shared<value_type>()) { }
+
+  /// Construct from value
+  explicit CopyOnWrite(const value_type& value):
+    m_data(std::make_shared<value_type>(value)) { }
+
+  /// Read-only access (never copies)
+  const value_type& get() const { return *m_data; }
+  const value_type& operator*() const { return get(); }
+  const value_type* operator->() const { return m_data.get(); }
+
+  /// Write access, detaches from copies sharing the same value
+  value_type& mutate() {
+    if PBORI_UNLIKELY(shared())
+      m_data = std::make_shared<value_type>(*m_data);
+    return *m_data;
+  }
+
+  /// Check whether the value is currently shared with other copies
+  bool shared() const { return m_data.use_count() > 1; }
+
+private:
+  pointer_type m_data;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_CopyOnWrite_h_ */
@@ -0,0 +1,215 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file DivisorBitMask.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c DivisorBitMask.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_DivisorBitMask_h_
+#define polybori_groebner_DivisorBitMask_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class DivisorBitMask
+ * @brief This class tests divisibility by a set of variables and monomials
+ * of degree two on bit masks.
+ *
+ * The variables of the (filter) set are numbered by the bits of a machine
+ * word. While descending the diagram of the terms, the filter variables on
+ * the path are collected in such a mask. A then-branch is cut off, if its
+ * variable is in the filter, or if the mask of the partners @f$x_j@f$ of
+ * products @f$x_i x_j@f$ in the filter intersects the path. Hence, each node
+ * is tested by a few word operations. Results of nodes with several parents
+ * are memorized (per node and mask) for the current call only, the computed
+ * table is not involved.
+ *
+ * @note This is a fast path of @c mod_deg2_set and @c mod_mon_set. The masks
+ * are set up once per call, the diagram-based algorithms are used for all
+ * other filters. (For sets of variables only, @c mod_var_set is as fast.)
+ **/
+class DivisorBitMask {
+  typedef DivisorBitMask self;
+
+public:
+  typedef unsigned long word_type;
+
+  enum {
+    /// Maximal number of variables of the filter
+    max_variables = sizeof(word_type) * 8,
+    /// Maximal number of filter terms
+    max_filter_terms = 256
+  };
+
+  /// Setup masks for filter, check valid() before use
+  DivisorBitMask(const MonomialSet& filter):
+    m_variables(), m_positions(), m_filter(), m_partners(), m_linear(0), m_quadratic(0),
+    m_one(false), m_valid(assign(filter)) {}
+
+  /// Check whether filter consists of at most max_variables variables and
+  /// max_filter_terms terms of degree at most two
+  bool valid() const { return m_valid; }
+
+  /// Compute terms not divisible by any element of filter
+  MonomialSet modulo(const MonomialSet& terms) const {
+    PBORI_ASSERT(valid());
+    if (m_one)
+      return MonomialSet(terms.ring());
+
+    memo_type memo;
+    return modulo(memo, terms.ring(), terms.navigation(), 0);
+  }
+
+  /// Compute terms not divisible by any element of filter, returns false (and
+  /// leaves result untouched) if the fast path is not applicable
+  static bool modulo(const MonomialSet& terms, const MonomialSet& filter,
+                     MonomialSet& result) {
+    self mask(filter);
+    if (!mask.valid())
+      return false;
+
+    result = mask.modulo(terms);
+    return true;
+  }
+
+protected:
+  typedef MonomialSet::navigator navigator;
+
+  /// Hash of a node and the mask on its path
+  struct hash_type {
+    std::size_t operator()(const std::pair<navigator, word_type>& key) const {
+      return key.first.hash() * 31 + std::size_t(key.second);
+    }
+  };
+  typedef std::unordered_map<std::pair<navigator, word_type>, MonomialSet,
+                             hash_type> memo_type;
+
+  /// Setup masks, fails for filters of higher degrees or too many variables
+  bool assign(const MonomialSet& filter) {
+    if (!collect(filter.navigation(), -1, -1, 0))
+      return false;
+
+    std::sort(m_variables.begin(), m_variables.end());
+    m_variables.erase(std::unique(m_variables.begin(), m_variables.end()),
+                      m_variables.end());
+    if (m_variables.size() > max_variables)
+      return false;
+
+    if (!m_variables.empty())
+      m_positions.assign(m_variables.back() - m_variables.front() + 1, -1);
+    for (std::size_t pos = 0; pos < m_variables.size(); ++pos)
+      m_positions[m_variables[pos] - m_variables.front()] = pos;
+
+    m_partners.assign(m_variables.size(), 0);
+    for (std::vector<std::pair<idx_type, idx_type> >::const_iterator
+           start(m_filter.begin()); start != m_filter.end(); ++start) {
+      if (start->first < 0)
+        m_one = true;
+      else if (start->second < 0)
+        m_linear |= bit(start->first);
+      else {
+        m_partners[position(start->first)] |= bit(start->second);
+        m_partners[position(start->second)] |= bit(start->first);
+        m_quadratic |= bit(start->first) | bit(start->second);
+      }
+    }
+    return true;
+  }
+
+  /// Collect up to max_filter_terms terms of degree at most two (fails
+  /// otherwise), missing variables of the terms are marked by -1
+  bool collect(navigator navi, idx_type first, idx_type second, unsigned deg) {
+    if (navi.isConstant()) {
+      if (navi.terminalValue())
+        m_filter.push_back(std::make_pair(first, second));
+      return (m_filter.size() <= max_filter_terms);
+    }
+    if (deg == 2)
+      return false;
+
+    idx_type var = *navi;
+    m_variables.push_back(var);
+    return (deg == 0? collect(navi.thenBranch(), var, second, 1):
+            collect(navi.thenBranch(), first, var, 2)) &&
+      collect(navi.elseBranch(), first, second, deg);
+  }
+
+  /// Remove terms (of the diagram) divisible by an element of the filter,
+  /// bits contains the filter variables on the path to navi
+  MonomialSet modulo(memo_type& memo, const BoolePolyRing& ring,
+                     navigator navi, word_type bits) const {
+    if (navi.isConstant())
+      return MonomialSet(ring, navi);
+
+    // only quadratic filter variables on the path matter below navi, and
+    // nodes with a single parent are reached once per visit of the parent
+    bits &= m_quadratic;
+    bool shared = (PBORI_PREFIX(Cudd_Regular)(navi.getNode())->ref > 1);
+    if (shared) {
+      memo_type::const_iterator found = memo.find(std::make_pair(navi, bits));
+      if (found != memo.end())
+        return found->second;
+    }
+
+    idx_type var = *navi;
+    MonomialSet then_branch(ring);
+    int pos = position(var);
+    if (pos >= 0) {
+      word_type current = word_type(1) << pos;
+      if (!((current & m_linear) || (m_partners[pos] & bits)))
+        then_branch = modulo(memo, ring, navi.thenBranch(), bits | current);
+    }
+    else
+      then_branch = modulo(memo, ring, navi.thenBranch(), bits);
+    MonomialSet else_branch = modulo(memo, ring, navi.elseBranch(), bits);
+
+    MonomialSet result(ring);
+    if ((then_branch.navigation() == navi.thenBranch()) &&
+        (else_branch.navigation() == navi.elseBranch()))
+      result = MonomialSet(ring, navi);
+    else if (then_branch.isZero())
+      result = else_branch;
+    else
+      result = MonomialSet(var, then_branch, else_branch);
+    if (shared)
+      memo.insert(std::make_pair(std::make_pair(navi, bits), result));
+    return result;
+  }
+
+  /// Bit position of a filter variable, -1 for other variables
+  int position(idx_type var) const {
+    if (m_variables.empty() || (var < m_variables.front()) ||
+        (var > m_variables.back()))
+      return -1;
+    return m_positions[var - m_variables.front()];
+  }
+
+  word_type bit(idx_type var) const { return word_type(1) << position(var); }
+
+private:
+  std::vector<idx_type> m_variables;
+  std::vector<int> m_positions;
+  std::vector<std::pair<idx_type, idx_type> > m_filter;
+  std::vector<word_type> m_partners;
+  word_type m_linear, m_quadratic;
+  bool m_one, m_valid;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_DivisorBitMask_h_ */
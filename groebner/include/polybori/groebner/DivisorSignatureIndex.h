@@ -0,0 +1,114 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file DivisorSignatureIndex.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c DivisorSignatureIndex.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_DivisorSignatureIndex_h_
+#define polybori_groebner_DivisorSignatureIndex_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+
+#include <algorithm>
+#include <vector>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class DivisorSignatureIndex
+ * @brief This class defines a Bloom-style filter for divisibility by the
+ * elements of a set of monomials.
+ *
+ * The signature of a monomial is a word with the bits @f$i \bmod 64@f$ set for
+ * all its variables @f$x_i@f$. A monomial can only divide a term, if its
+ * signature is a subset of that of the term. The signatures are stored in
+ * buckets by their smallest variable, so a query only scans the buckets of the
+ * variables of the term.
+ *
+ * @note Negative answers are exact, positive ones have to be confirmed.
+ **/
+class DivisorSignatureIndex {
+  typedef DivisorSignatureIndex self;
+
+public:
+  typedef unsigned long word_type;
+  typedef std::vector<word_type> bucket_type;
+
+  DivisorSignatureIndex(): m_buckets(), m_one(0) { }
+
+  /// Add monomial
+  void insert(const Exponent& exp) {
+    if PBORI_UNLIKELY(exp.deg() == 0) {
+      ++m_one;
+      return;
+    }
+    bucket(*exp.begin()).push_back(signature(exp.begin(), exp.end()));
+  }
+
+  /// Remove monomial (which was inserted before)
+  void erase(const Exponent& exp) {
+    if PBORI_UNLIKELY(exp.deg() == 0) {
+      PBORI_ASSERT(m_one > 0);
+      --m_one;
+      return;
+    }
+    bucket_type& entries = bucket(*exp.begin());
+    bucket_type::iterator found =
+      std::find(entries.begin(), entries.end(),
+                signature(exp.begin(), exp.end()));
+    PBORI_ASSERT(found != entries.end());
+    *found = entries.back();
+    entries.pop_back();
+  }
+
+  /// Check, whether some monomial may divide the term with given variables
+  template <class Iterator>
+  bool mayDivide(Iterator start, Iterator finish) const {
+    if PBORI_UNLIKELY(m_one > 0)
+      return true;
+
+    const word_type sig = signature(start, finish);
+    for (; start != finish; ++start) {
+      if ((std::size_t)*start >= m_buckets.size())
+        break;
+      const bucket_type& entries = m_buckets[*start];
+      for (bucket_type::const_iterator iter(entries.begin());
+           iter != entries.end(); ++iter)
+        if ((*iter & ~sig) == 0)
+          return true;
+    }
+    return false;
+  }
+
+protected:
+  bucket_type& bucket(idx_type idx) {
+    if ((std::size_t)idx >= m_buckets.size())
+      m_buckets.resize(idx + 1);
+    return m_buckets[idx];
+  }
+
+  template <class Iterator>
+  static word_type signature(Iterator start, Iterator finish) {
+    word_type result = 0;
+    for (; start != finish; ++start)
+      result |= word_type(1) << (*start % (sizeof(word_type) * 8));
+    return result;
+  }
+
+private:
+  std::vector<bucket_type> m_buckets;
+  std::size_t m_one;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_DivisorSignatureIndex_h_ */
@@ -18,22 +18,20 @@
 
 // include basic definitions
 #include "groebner_defs.h"
+#include "ExpOrderDispatch.h"
 
 BEGIN_NAMESPACE_PBORIGB
 
 /** @class ExpGreater
  * @brief This class defines ExpGreater.
  *
+ * @note For sorting, @c sort_exp_greater avoids the switch over orderings.
  **/
 class ExpGreater:
-  public CFactoryBase {
+  public ExpGreaterBy<DispatchedExpCompare> {
 public:
-  ExpGreater(const BoolePolyRing& ring): CFactoryBase(ring) {}
-
-  bool operator()(const BooleExponent& lhs,
-		  const BooleExponent& rhs) const {
-    return parent().ordering().compare(lhs,rhs)==CTypes::greater_than;
-  }
+  ExpGreater(const BoolePolyRing& ring):
+    ExpGreaterBy<DispatchedExpCompare>(DispatchedExpCompare(ring)) {}
 };
 
 END_NAMESPACE_PBORIGB
@@ -0,0 +1,212 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file ExpOrderDispatch.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes inlined comparisons of exponents for the orderings of
+ * the rings and the function templates, which select them once for a loop.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_ExpOrderDispatch_h_
+#define polybori_groebner_ExpOrderDispatch_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+
+#include <algorithm>
+#include <vector>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/// @name Inlined three-way comparisons of exponents for the concrete
+/// orderings (equivalent to their @c compare, but without testing for
+/// equality in advance)
+//@{
+struct LexExpCompare {
+  CTypes::comp_type operator()(const Exponent& lhs, const Exponent& rhs) const {
+    return lex_compare_3way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                            LexOrder::idx_comparer_type());
+  }
+};
+
+struct DegLexExpCompare {
+  CTypes::comp_type operator()(const Exponent& lhs, const Exponent& rhs) const {
+    if (lhs.size() != rhs.size())
+      return (lhs.size() > rhs.size()? CTypes::greater_than:
+              CTypes::less_than);
+    return lex_compare_3way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                            DegLexOrder::idx_comparer_type());
+  }
+};
+
+struct DegRevLexAscExpCompare {
+  CTypes::comp_type operator()(const Exponent& lhs, const Exponent& rhs) const {
+    if (lhs.size() != rhs.size())
+      return (lhs.size() > rhs.size()? CTypes::greater_than:
+              CTypes::less_than);
+    return lex_compare_3way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                            DegRevLexAscOrder::idx_comparer_type());
+  }
+};
+
+template <class IdxComparerType>
+class BlockExpCompare {
+public:
+  typedef COrderingBase::block_iterator block_iterator;
+
+  /// @note the ordering of ring must not be changed while in use
+  BlockExpCompare(const BoolePolyRing& ring):
+    m_start(ring.ordering().blockBegin()),
+    m_finish(ring.ordering().blockEnd()) {}
+
+  CTypes::comp_type operator()(const Exponent& lhs, const Exponent& rhs) const {
+    return block_dlex_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                              m_start, m_finish, IdxComparerType());
+  }
+
+private:
+  block_iterator m_start, m_finish;
+};
+
+typedef BlockExpCompare<BlockDegLexOrder::idx_comparer_type>
+BlockDegLexExpCompare;
+typedef BlockExpCompare<BlockDegRevLexAscOrder::idx_comparer_type>
+BlockDegRevLexAscExpCompare;
+
+/// Fallback for other orderings, using the virtual @c compare
+class OrderingExpCompare:
+  public CFactoryBase {
+public:
+  OrderingExpCompare(const BoolePolyRing& ring): CFactoryBase(ring) {}
+
+  CTypes::comp_type operator()(const Exponent& lhs, const Exponent& rhs) const {
+    return parent().ordering().compare(lhs, rhs);
+  }
+};
+//@}
+
+/** @class DispatchedExpCompare
+ * @brief This class compares exponents w.r.t. the ordering of a ring.
+ *
+ * The ordering is determined on construction, such that comparisons only
+ * switch over the (constant) ordering code to inlined code instead of
+ * calling the virtual @c COrderingBase::compare. It is meant for comparators,
+ * whose type is fixed (e.g. by a container). Otherwise, prefer
+ * @c dispatch_exp_compare.
+ *
+ * @note the ordering of ring must not be changed while in use
+ **/
+class DispatchedExpCompare:
+  public CFactoryBase {
+public:
+  DispatchedExpCompare(const BoolePolyRing& ring):
+    CFactoryBase(ring), m_code(ring.ordering().getOrderCode()),
+    m_start(ring.ordering().blockBegin()),
+    m_finish(ring.ordering().blockEnd()) {}
+
+  CTypes::comp_type operator()(const Exponent& lhs, const Exponent& rhs) const {
+    switch(m_code) {
+    case COrderEnums::lp:
+      return LexExpCompare()(lhs, rhs);
+    case COrderEnums::dlex:
+      return DegLexExpCompare()(lhs, rhs);
+    case COrderEnums::dp_asc:
+      return DegRevLexAscExpCompare()(lhs, rhs);
+    case COrderEnums::block_dlex:
+      return block_dlex_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+        m_start, m_finish, BlockDegLexOrder::idx_comparer_type());
+    case COrderEnums::block_dp_asc:
+      return block_dlex_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+        m_start, m_finish, BlockDegRevLexAscOrder::idx_comparer_type());
+    default:
+      return parent().ordering().compare(lhs, rhs);
+    }
+  }
+
+private:
+  CTypes::ordercode_type m_code;
+  COrderingBase::block_iterator m_start, m_finish;
+};
+
+/// Strict weak ordering from three-way comparison (greater first)
+template <class CompareType>
+class ExpGreaterBy {
+public:
+  ExpGreaterBy(const CompareType& compare = CompareType()):
+    m_compare(compare) {}
+
+  bool operator()(const Exponent& lhs, const Exponent& rhs) const {
+    return m_compare(lhs, rhs) == CTypes::greater_than;
+  }
+
+private:
+  CompareType m_compare;
+};
+
+/// Call op with the inlined three-way comparison for the ordering of ring
+template <class OperationType>
+void
+dispatch_exp_compare(const BoolePolyRing& ring, OperationType& op) {
+  switch(ring.ordering().getOrderCode()) {
+  case COrderEnums::lp:
+    op(LexExpCompare());
+    break;
+  case COrderEnums::dlex:
+    op(DegLexExpCompare());
+    break;
+  case COrderEnums::dp_asc:
+    op(DegRevLexAscExpCompare());
+    break;
+  case COrderEnums::block_dlex:
+    op(BlockDegLexExpCompare(ring));
+    break;
+  case COrderEnums::block_dp_asc:
+    op(BlockDegRevLexAscExpCompare(ring));
+    break;
+  default:
+    op(OrderingExpCompare(ring));
+  }
+}
+
+/// Sort [start, finish) w.r.t. the ordering of ring (greater first)
+template <class IteratorType>
+class SortExpGreater {
+public:
+  SortExpGreater(IteratorType start, IteratorType finish):
+    m_start(start), m_finish(finish) {}
+
+  template <class CompareType>
+  void operator()(const CompareType& compare) const {
+    std::sort(m_start, m_finish, ExpGreaterBy<CompareType>(compare));
+  }
+
+private:
+  IteratorType m_start, m_finish;
+};
+
+template <class IteratorType>
+inline void
+sort_exp_greater(IteratorType start, IteratorType finish,
+                 const BoolePolyRing& ring) {
+  SortExpGreater<IteratorType> op(start, finish);
+  dispatch_exp_compare(ring, op);
+}
+
+/// Positions of exps ordered w.r.t. the ordering of ring (greater first),
+/// i.e. exps[result[0]] is the greatest one
+/// @note exps must be lex sorted (greater first) like the iteration of a
+/// @c MonomialSet, then (block) degree orderings take linear time
+std::vector<std::size_t>
+lex_sorted_to_ring_order(const std::vector<Exponent>& exps,
+                         const BoolePolyRing& ring);
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_ExpOrderDispatch_h_ */
@@ -11,10 +11,7 @@
 
 #include <polybori/BoolePolyRing.h>
 #include "groebner_alg.h"
-
-extern "C" {
-#include <m4ri/m4ri.h>
-}
+#include "SparseRowMatrix.h"
 
 BEGIN_NAMESPACE_PBORIGB
 
@@ -32,37 +29,52 @@ class FGLMStrategy{
 
 public:
     typedef BoolePolyRing ring_with_ordering_type;
+    typedef SparseRowMatrix::row_type SparseRow;
+
+    /// Minimal number of edges per thread for setting up the tables
+    enum { parallel_cutoff = 1024 };
 
-    FGLMStrategy(const ring_with_ordering_type& from_ring, const ring_with_ordering_type& to_ring,  const PolynomialVector& gb);
+    /// Setup multiplication tables for the reduced Groebner basis gb using
+    /// nthreads threads (0: choose by hardware and number of edges)
+    FGLMStrategy(const ring_with_ordering_type& from_ring, const ring_with_ordering_type& to_ring,  const PolynomialVector& gb, unsigned nthreads = 0);
  
     PolynomialVector main();
     void analyzeGB(const ReductionStrategy& gb);
     void setupMultiplicationTables();
     void setupStandardMonomialsFromTables();
-    void writeRowToVariableDivisors(mzd_t* row, Monomial lm);
+    void writeRowToVariableDivisors(const SparseRow& row, Monomial lm);
     void testMultiplicationTables();
-    void transposeMultiplicationTables();
-    void writeTailToRow(MonomialSet tail, mzd_t* row);
-    Polynomial rowToPoly(mzd_t* row);
-    //allocates a window, free it with mzd_free_window
-    void findVectorInMultTables(mzd_t* dst, Monomial m);
-    mzd_t* multiplicationTableForVariable(const Variable& v){
+    void writeTailToRow(MonomialSet tail, SparseRow& row);
+    Polynomial rowToPoly(const SparseRow& row);
+    void findVectorInMultTables(SparseRow& dst, Monomial m);
+    const SparseRowMatrix& multiplicationTableForVariable(const Variable& v){
         return multiplicationTables[ring2Index[v.index()]];
     }
-    ~FGLMStrategy(){
-        for(std::size_t i=0;i<multiplicationTables.size();i++){
-            mzd_free(multiplicationTables[i]);
-        }
-    }
     typedef std::vector<idx_type> IndexVector;
 
 
 private:
+    typedef std::vector<std::pair<idx_type, std::size_t> > TableEntryVector;
+
+    /// Edge m=reduced_problem_to*var, its row is the row source (of
+    /// reduced_problem_to) times the table of var, which is written to entries
+    struct EdgeRow {
+        idx_type table;
+        std::pair<idx_type, std::size_t> source;
+        TableEntryVector entries;
+    };
+
+    //tables and rows of m/v for the variables v dividing m with m/v standard
+    void variableDivisors(Monomial m, TableEntryVector& entries);
+    void computeEdgeRows(const std::vector<EdgeRow>& edge_rows,
+        const std::vector<IndexVector>& written_by);
+
+    unsigned nThreads;
     bool prot;
     Monomial vars;
     size_t varietySize;
     typedef std::vector<Monomial> MonomialVector;
-    typedef std::vector<mzd_t*> MatrixVector;
+    typedef std::vector<SparseRowMatrix> MatrixVector;
     typedef std::vector<Variable> VariableVector;
     
     
@@ -83,19 +95,22 @@ private:
     IndexVector index2Ring;
     IndexVector rowStartingWithIndex;
     MonomialSet::size_type nVariables;
-    bool transposed;
-    std::vector<IndexVector> tableXRowYIsMonomialFromWithIndex;
     lm2Index_map_type standardMonomialsFrom2Index;
     lm2Index_map_type monomial2MultiplicationMatrix;
     lm2Index_map_type monomial2MultiplicationMatrixRowIndex;
     MatrixVector multiplicationTables;
+    SparseRowMatrix::Accumulator accumulator;
     
     bool canAddThisElementLaterToGB(Polynomial p);
     PolynomialVector addTheseLater;
     IndexVector rowIsStandardMonomialToWithIndex;
     Exponent::idx_map_type standardExponentsFrom2Index;
     Polynomial reducedNormalFormInFromRing(Polynomial f);
-    IndexVector rowVectorIsLinearCombinationOfRows(mzd_t* mat,   mzd_t* v);
+    //rows of w are reduced, those of wCombinations denote them in terms of
+    //the basis; on failure remainder is v reduced up to its first entry
+    IndexVector rowVectorIsLinearCombinationOfRows(const SparseRowMatrix& w,
+        const SparseRowMatrix& wCombinations, const SparseRow& v,
+        SparseRow& remainder, SparseRow& combination);
     };
 END_NAMESPACE_PBORIGB
 #endif    
@@ -0,0 +1,231 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file GeoBucket.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c GeoBucket.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_GeoBucket_h_
+#define polybori_groebner_GeoBucket_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+
+#include <algorithm>
+#include <vector>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class GeoBucket
+ * @brief This class defines a geobucket, which accumulates a sum of
+ * polynomials for any ordering.
+ *
+ * Summands are collected in buckets of geometrically growing capacity
+ * (measured by upper bounds of their lengths), so small summands are not added
+ * to the (large) initial polynomial one by one. A full bucket is merged into
+ * the next one. The leading term is computed from the leading terms of the
+ * buckets, the whole sum only by @c value().
+ *
+ * Optionally, upper bounds of the degrees of the summands may be given. They
+ * are kept per bucket, so leading terms of the buckets are computed by the
+ * (cheaper) @c boundedLead() for degree orderings. A negative bound means
+ * unknown.
+ **/
+class GeoBucket {
+  typedef GeoBucket self;
+
+public:
+  typedef std::size_t size_type;
+  typedef CTypes::deg_type deg_type;
+
+  /// Ratio of the capacities of consecutive buckets and number of buckets
+  enum { ratio = 4, max_levels = 8 };
+
+  /// Construct from (large) initial polynomial of degree at most bound
+  GeoBucket(const Polynomial& p, deg_type bound = -1):
+    m_front(p), m_frontBound(bound), m_buckets(), m_sizes(), m_bounds(),
+    m_parts(), m_lead(p.ring()), m_normalized(false), m_zero(false) { }
+
+  /// Replace all contents by p (of degree at most bound)
+  void reset(const Polynomial& p, deg_type bound = -1) {
+    m_front = p;
+    m_frontBound = bound;
+    m_buckets.clear();
+    m_sizes.clear();
+    m_bounds.clear();
+    m_normalized = false;
+  }
+
+  /// Add polynomial, size is an upper bound for its length (and bound for its
+  /// degree)
+  void add(const Polynomial& p, size_type size, deg_type bound = -1) {
+    size_type level = 0;
+    for (size_type capacity = ratio; (capacity < size) && (level < max_levels);
+         capacity *= ratio)
+      ++level;
+    insert(p, size, bound, level);
+  }
+
+  /// Check whether the sum is zero
+  bool isZero() {
+    normalize();
+    return m_zero;
+  }
+
+  /// Leading term of the sum (which must not be zero)
+  const Monomial& lead() {
+    normalize();
+    PBORI_ASSERT(!m_zero);
+    return m_lead;
+  }
+
+  /// Sum of all summands
+  Polynomial value() {
+    for (size_type level = 0; level < m_buckets.size(); ++level) {
+      m_front += m_buckets[level];
+      m_frontBound = joined(m_frontBound, m_bounds[level]);
+    }
+    m_buckets.clear();
+    m_sizes.clear();
+    m_bounds.clear();
+    return m_front;
+  }
+
+protected:
+  /// Add p into bucket of given level, overflowing buckets move up
+  void insert(Polynomial p, size_type size, deg_type bound, size_type level) {
+    m_normalized = false;
+    while (level < max_levels) {
+      if (level >= m_buckets.size()) {
+        m_buckets.resize(level + 1, p.ring().zero());
+        m_sizes.resize(level + 1, 0);
+        m_bounds.resize(level + 1, 0);
+      }
+      m_buckets[level] += p;
+      m_sizes[level] += size;
+      m_bounds[level] = joined(m_bounds[level], bound);
+      if (m_sizes[level] <= capacity(level))
+        return;
+
+      p = m_buckets[level];
+      size = m_sizes[level];
+      bound = m_bounds[level];
+      m_buckets[level] = p.ring().zero();
+      m_sizes[level] = 0;
+      m_bounds[level] = 0;
+      ++level;
+    }
+    m_front += p;
+    m_frontBound = joined(m_frontBound, bound);
+  }
+
+  /// Degree bound of a sum (negative bounds are unknown)
+  static deg_type joined(deg_type lhs, deg_type rhs) {
+    return ((lhs < 0) || (rhs < 0)? -1: std::max(lhs, rhs));
+  }
+
+  /// Leading term of a nonzero part of degree at most bound
+  static Monomial lead(const Polynomial& p, deg_type bound) {
+    return (bound < 0? p.lead(): p.boundedLead(bound));
+  }
+
+  /// Capacity of bucket
+  static size_type capacity(size_type level) {
+    size_type result = ratio;
+    while (level-- > 0)
+      result *= ratio;
+    return result;
+  }
+
+  /// Cancel common leading terms of the buckets and store leading term
+  void normalize() {
+    if (m_normalized)
+      return;
+
+    const BoolePolyRing& ring = m_front.ring();
+    m_parts.clear();
+    if (!m_front.isZero())
+      m_parts.push_back(part_type(&m_front, lead(m_front, m_frontBound),
+                                  m_frontBound));
+    for (size_type level = 0; level < m_buckets.size(); ++level)
+      if (!m_buckets[level].isZero())
+        m_parts.push_back(part_type(&m_buckets[level],
+                                    lead(m_buckets[level], m_bounds[level]),
+                                    m_bounds[level]));
+
+    while (!m_parts.empty()) {
+      // over GF(2) the largest term survives iff it occurs an odd number of
+      // times (only as leading term of some parts)
+      size_type largest = 0, count = 1;
+      for (size_type idx = 1; idx < m_parts.size(); ++idx) {
+        CTypes::comp_type comp =
+          ring.ordering().compare(m_parts[idx].lead, m_parts[largest].lead);
+        if (comp == CTypes::greater_than) {
+          largest = idx;
+          count = 1;
+        }
+        else if (comp == CTypes::equality)
+          ++count;
+      }
+
+      if (count % 2 == 1) {
+        m_lead = m_parts[largest].lead;
+        m_zero = false;
+        m_normalized = true;
+        return;
+      }
+
+      const Monomial term = m_parts[largest].lead;
+      for (size_type idx = 0; idx < m_parts.size();) {
+        if (m_parts[idx].lead != term) {
+          ++idx;
+          continue;
+        }
+        Polynomial& part = *m_parts[idx].poly;
+        part = Polynomial(part.diagram().diff(term.diagram()));
+        if (part.isZero()) {
+          m_parts[idx] = m_parts.back();
+          m_parts.pop_back();
+        }
+        else {
+          m_parts[idx].lead = lead(part, m_parts[idx].bound);
+          ++idx;
+        }
+      }
+    }
+    m_zero = true;
+    m_normalized = true;
+  }
+
+private:
+  /// Nonzero part of the sum, its leading term and degree bound
+  struct part_type {
+    part_type(Polynomial* poly_, const Monomial& lead_, deg_type bound_):
+      poly(poly_), lead(lead_), bound(bound_) { }
+
+    Polynomial* poly;
+    Monomial lead;
+    deg_type bound;
+  };
+
+  Polynomial m_front;
+  deg_type m_frontBound;
+  std::vector<Polynomial> m_buckets;
+  std::vector<size_type> m_sizes;
+  std::vector<deg_type> m_bounds;
+  std::vector<part_type> m_parts;
+  Monomial m_lead;
+  bool m_normalized, m_zero;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_GeoBucket_h_ */
@@ -0,0 +1,136 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file GroebnerBudget.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c GroebnerBudget.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_GroebnerBudget_h_
+#define polybori_groebner_GroebnerBudget_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+#include <polybori/cudd/cudd.h>
+
+#include <chrono>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class GroebnerBudget
+ * @brief This class defines resource limits for a @c GroebnerStrategy run.
+ *
+ * The limits are checked cooperatively by @c GroebnerStrategy::symmGB_F2(),
+ * @c parallel_reduce and @c GroebnerStrategy::faugereStepDense(). Work which
+ * was not finished, is kept as delayed pairs, so the strategy can be
+ * continued (or saved to disk) afterwards.
+ *
+ * The clock is started by the outermost of these entry points, which is
+ * running (see @c GroebnerBudget::Run), so each top-level call gets the full
+ * time budget, no matter whether it comes from @c symmGB_F2() or from a
+ * driver calling @c parallel_reduce directly.
+ *
+ * @note A value of zero (or a negative degree) means unbounded.
+ **/
+class GroebnerBudget {
+  typedef std::chrono::steady_clock clock_type;
+
+public:
+  /** @class Run
+   * @brief Starts the clock of a budget for the lifetime of this object,
+   * unless an enclosing run has started it already.
+   **/
+  class Run {
+  public:
+    Run(GroebnerBudget& budget): m_budget(budget),
+                                 m_outermost(!budget.m_running) {
+      if (m_outermost)
+        m_budget.start();
+    }
+    ~Run() {
+      if (m_outermost)
+        m_budget.m_running = false;
+    }
+
+  private:
+    Run(const Run&);
+    Run& operator=(const Run&);
+
+    GroebnerBudget& m_budget;
+    bool m_outermost;
+  };
+
+  /// Constructor with unbounded settings
+  GroebnerBudget():
+    maxSeconds(0), maxNodes(0), maxDegree(-1),
+    m_start(clock_type::now()), m_running(false), m_interrupted(false) { }
+
+  /// Copy constructor (copies are not part of a running computation)
+  GroebnerBudget(const GroebnerBudget& rhs):
+    maxSeconds(rhs.maxSeconds), maxNodes(rhs.maxNodes),
+    maxDegree(rhs.maxDegree), m_start(rhs.m_start), m_running(false),
+    m_interrupted(rhs.m_interrupted) { }
+
+  /// Start the clock for the time budget
+  void start() {
+    m_start = clock_type::now();
+    m_running = true;
+    m_interrupted = false;
+  }
+
+  /// Check, whether one of the limits is set
+  bool bounded() const {
+    return (maxSeconds > 0) || (maxNodes > 0) || (maxDegree >= 0);
+  }
+
+  /// Check, whether the time or the memory (nodes of the diagrams) is used up
+  bool exhausted(const BoolePolyRing& ring) const {
+    if PBORI_LIKELY(!bounded())
+      return false;
+
+    if ((maxSeconds > 0) &&
+        (std::chrono::duration<double>(clock_type::now() - m_start).count()
+         > maxSeconds))
+      m_interrupted = true;
+
+    if ((maxNodes > 0) &&
+        (PBORI_PREFIX(Cudd_zddReadNodeCount)(ring.getManager()) > maxNodes))
+      m_interrupted = true;
+
+    return m_interrupted;
+  }
+
+  /// Check, whether pairs of given sugar degree are beyond the limit
+  bool exceeds(deg_type sugar) const {
+    if ((maxDegree >= 0) && (sugar > maxDegree))
+      m_interrupted = true;
+    return m_interrupted;
+  }
+
+  /// Check, whether the last run stopped before completion
+  bool interrupted() const { return m_interrupted; }
+
+  /// @name public available parameters
+  /// Wall clock time per run
+  double maxSeconds;
+  /// Decision diagram nodes, which dominate the memory usage
+  long maxNodes;
+  /// Sugar degree of pairs to be treated
+  deg_type maxDegree;
+
+private:
+  clock_type::time_point m_start;
+  bool m_running;
+  mutable bool m_interrupted;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_GroebnerBudget_h_ */
@@ -39,7 +39,8 @@ public:
     optModifiedLinearAlgebra(false), optDelayNonMinimals(true),
     enabledLog(false), optExchange(true), optHFE(false), optStepBounded(false),
     optAllowRecursion(true), optLinearAlgebraInLastBlock(true),
-    reduceByTailReduced(false) { }
+    reduceByTailReduced(false), optBatchTailReduce(false), reductionLanes(1),
+    optBlockTables(false) { }
 
   bool optRedTailInLastBlock;
   bool optLazy;
@@ -58,6 +59,14 @@ public:
   bool optLinearAlgebraInLastBlock;
 
   bool reduceByTailReduced;
+  /// Tail reduce the final basis at once (see @c BatchRedTail)
+  bool optBatchTailReduce;
+  /// Maximal number of groups of equal leading terms reduced at once in
+  /// @c parallel_reduce (multiplications of large diagrams are run in parallel)
+  unsigned reductionLanes;
+  /// Use generated Groebner tables for polynomials in several blocks of a
+  /// block ordering (see @c GroebnerTableGenerator)
+  bool optBlockTables;
 };
 
 END_NAMESPACE_PBORIGB
@@ -25,9 +25,12 @@
 #include "groebner_defs.h"
 #include "PolyEntryPtrLmLess.h"
 #include "GroebnerOptions.h"
+#include "GroebnerBudget.h"
+#include "GroebnerTableGenerator.h"
 
 #include <vector>
 #include <memory>
+#include <iostream>
 
 #include <polybori/routines/pbori_algo.h> // member-for_each etc.
 
@@ -43,7 +46,7 @@ class GroebnerStrategy:
 
   typedef GroebnerStrategy self;
 public:
-  /// copy constructor
+  /// copy constructor (cheap snapshot, data is shared copy-on-write)
   GroebnerStrategy(const GroebnerStrategy& orig);
 
   /// Construct from a ring
@@ -54,6 +57,8 @@ public:
     generators(input_ring),
 
     cache(new CacheManager()),
+    tableGenerators(new GroebnerTableGenerators()),
+    reductionSteps(0), normalForms(0), currentDegree(0), averageLength(0),
     chainCriterions(0),  variableChainCriterions(0), 
     easyProductCriterions(0), extendedProductCriterions(0) { }
 
@@ -77,6 +82,7 @@ public:
 
 
   Polynomial nextSpoly(){ return pairs.nextSpoly(generators);  }
+  Pair nextPair(){ return pairs.nextPair(generators);  }
   void addNonTrivialImplicationsDelayed(const PolyEntry& p);
   void propagate(const PolyEntry& e); 
 
@@ -89,6 +95,15 @@ public:
   Polynomial nf(Polynomial p) const;
   void symmGB_F2();
   int suggestPluginVariable();
+
+  /// Version of the layout written by @c save(), increase it with every
+  /// change of the layout (@c load() rejects other versions)
+  enum { save_format_version = 3 };
+
+  /// Write generators, pair queue and pair status (for continuing later)
+  void save(std::ostream& output) const;
+  /// Restore saved state into a newly constructed strategy
+  void load(std::istream& input);
   std::vector<Polynomial> allGenerators();
 
 
@@ -199,10 +214,16 @@ private:
 
   bool shorterElimination(const MonomialSet& divisors, wlen_type el,
                            MonomialSet::deg_type deg) const;
+
+  /// Maximal number of variables of polynomials, whose implications are
+  /// looked up in Groebner tables (0 if tables do not apply to p)
+  unsigned tableVariables(const Polynomial& p) const;
 public:
   /// @name public available parameters
   ReductionStrategy generators;
   std::shared_ptr<CacheManager> cache;
+  std::shared_ptr<GroebnerTableGenerators> tableGenerators;
+  GroebnerBudget budget;
 
   unsigned int reductionSteps;
   int normalForms;
@@ -0,0 +1,199 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file GroebnerTableGenerator.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c GroebnerTableGenerator.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_GroebnerTableGenerator_h_
+#define polybori_groebner_GroebnerTableGenerator_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class GroebnerTableGenerator
+ * @brief This class generates Groebner tables like @c lp4var_data on demand,
+ * for up to five variables and any ordering (including block orderings).
+ *
+ * As for the precomputed tables, a polynomial in the variables
+ * @f$x_{i_0},\ldots,x_{i_{k-1}}@f$ (with @f$i_0 < \ldots < i_{k-1}@f$) is
+ * encoded by a word, which has the bit @f$\sum_{j\in J} 2^j@f$ set for each
+ * of its terms @f$\prod_{j\in J} x_{i_j}@f$. The reduced Groebner basis of the
+ * ideal generated by the polynomial (and the field equations) is the vanishing
+ * ideal of its zeros. It is computed by the Buchberger-Moeller algorithm on
+ * the words of values of the terms at these zeros: proceeding in ascending
+ * order, a term is a leading term, iff its values are linearly dependent of
+ * those of the smaller standard terms.
+ *
+ * A generator only depends on the ordering induced on the used variables,
+ * hence generators are shared by all sets of variables with the same base
+ * ordering, number and distribution into blocks (see
+ * @c GroebnerTableGenerators). The bases are stored compactly in a single
+ * array of codes, each terminated by 0.
+ **/
+class GroebnerTableGenerator {
+  typedef GroebnerTableGenerator self;
+
+public:
+  typedef unsigned int code_type;
+
+  /// Maximal number of variables
+  enum { max_variables = 5 };
+
+  /// Sort terms of the used variables ascendingly
+  GroebnerTableGenerator(const BoolePolyRing& ring,
+                         const Exponent& used_variables):
+    m_nvars(used_variables.size()), m_terms(), m_offsets(), m_codes() {
+
+    PBORI_ASSERT(used_variables.size() <= max_variables);
+    std::vector<idx_type> variables(used_variables.begin(),
+                                    used_variables.end());
+    std::vector<Monomial> monomials;
+    for (code_type term = 0; term < (code_type(1) << m_nvars); ++term) {
+      Monomial monomial(ring);
+      for (unsigned idx = 0; idx < m_nvars; ++idx)
+        if (term & (code_type(1) << idx))
+          monomial *= ring.variable(variables[idx]);
+      monomials.push_back(monomial);
+      m_terms.push_back(term);
+    }
+    std::sort(m_terms.begin(), m_terms.end(),
+              [&monomials](code_type lhs, code_type rhs) {
+                return monomials[lhs] < monomials[rhs];
+              });
+  }
+
+  /// Codes of the reduced Groebner basis of the polynomial with code p_code,
+  /// terminated by 0 (valid until the next call)
+  const code_type* operator[](code_type p_code) {
+    std::unordered_map<code_type, std::size_t>::const_iterator found =
+      m_offsets.find(p_code);
+    if (found != m_offsets.end())
+      return &m_codes[found->second];
+
+    std::size_t offset = m_codes.size();
+    generate(p_code);
+    m_codes.push_back(0);
+    m_offsets.insert(std::make_pair(p_code, offset));
+    return &m_codes[offset];
+  }
+
+protected:
+  /// Append codes of the reduced Groebner basis to m_codes
+  void generate(code_type p_code) {
+    const code_type zeros = ~transform(p_code) & points();
+    std::vector<std::pair<code_type, code_type> > rows(sizeof(code_type) * 8);
+    std::vector<bool> leading(code_type(1) << m_nvars, false);
+
+    for (std::vector<code_type>::const_iterator start(m_terms.begin());
+         start != m_terms.end(); ++start) {
+      code_type values = transform(code_type(1) << *start) & zeros;
+      code_type combination = code_type(1) << *start;
+
+      unsigned pivot = 0;
+      while (values != 0) {
+        for (pivot = 0; !(values & (code_type(1) << pivot)); ++pivot) ;
+        if (rows[pivot].first == 0)
+          break;
+        values ^= rows[pivot].first;
+        combination ^= rows[pivot].second;
+      }
+
+      if (values != 0)
+        rows[pivot] = std::make_pair(values, combination);
+      else {
+        leading[*start] = true;
+        bool minimal = true;
+        for (unsigned idx = 0; idx < m_nvars; ++idx)
+          if ((*start & (code_type(1) << idx)) &&
+              leading[*start ^ (code_type(1) << idx)])
+            minimal = false;
+        if (minimal)
+          m_codes.push_back(combination);
+      }
+    }
+  }
+
+  /// Values of a polynomial at all points, equivalently the points above
+  /// given terms (subset sums over GF(2))
+  code_type transform(code_type code) const {
+    static const code_type lower[max_variables] = {
+      0x55555555u, 0x33333333u, 0x0f0f0f0fu, 0x00ff00ffu, 0x0000ffffu };
+    for (unsigned idx = 0; idx < m_nvars; ++idx)
+      code ^= (code & lower[idx]) << (1 << idx);
+    return code & points();
+  }
+
+  /// Mask of all points
+  code_type points() const {
+    return (m_nvars == max_variables? ~code_type(0):
+            (code_type(1) << (1 << m_nvars)) - 1);
+  }
+
+private:
+  unsigned m_nvars;
+  std::vector<code_type> m_terms;
+  std::unordered_map<code_type, std::size_t> m_offsets;
+  std::vector<code_type> m_codes;
+};
+
+/** @class GroebnerTableGenerators
+ * @brief This class keeps the generators of Groebner tables of a strategy.
+ *
+ * There is one generator per base ordering, number of used variables and
+ * distribution of these into blocks. The generators (and the bases computed
+ * so far) are released together with the strategy.
+ **/
+class GroebnerTableGenerators {
+public:
+  typedef GroebnerTableGenerator generator_type;
+
+  /// Construct without generators
+  GroebnerTableGenerators(): m_generators() {}
+
+  /// Generator for the ordering induced on the used variables
+  generator_type& operator()(const BoolePolyRing& ring,
+                             const Exponent& used_variables) {
+    PBORI_ASSERT(used_variables.size() <= generator_type::max_variables);
+
+    unsigned key = ring.ordering().getBaseOrderCode() * 1024 +
+      used_variables.size() * 32;
+    Exponent::const_iterator start(used_variables.begin()),
+      finish(used_variables.end());
+    for (unsigned pos = 1; (start != finish) && (start + 1 != finish);
+         ++start, ++pos)
+      if (!ring.ordering().lieInSameBlock(*start, *(start + 1)))
+        key |= 1 << pos;
+
+    std::unordered_map<unsigned, generator_type>::iterator found =
+      m_generators.find(key);
+    if (found == m_generators.end())
+      found = m_generators.insert(std::make_pair(key,
+        generator_type(ring, used_variables))).first;
+    return found->second;
+  }
+
+  /// Number of generators
+  std::size_t size() const { return m_generators.size(); }
+
+private:
+  std::unordered_map<unsigned, generator_type> m_generators;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_GroebnerTableGenerator_h_ */
@@ -0,0 +1,102 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file IncrementalInterpolation.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c IncrementalInterpolation.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_IncrementalInterpolation_h_
+#define polybori_groebner_IncrementalInterpolation_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class IncrementalInterpolation
+ * @brief This class collects sample points of a Boolean function in chunks,
+ * and provides the interpolating polynomial and the lexicographical Groebner
+ * basis of the vanishing ideal of the points seen so far.
+ *
+ * Points are given as monomials (the sets of variables with value one) and
+ * are united with the diagrams of the zeros and ones immediately, so the
+ * state is bounded by the size of these diagrams instead of the length of
+ * the stream. The standard monomials of the vanishing ideal (w.r.t. lex)
+ * are updated with each chunk, all other results are computed on demand.
+ *
+ * The staircases of the subdiagrams used by the last update are kept
+ * explicitly (not only in the computed table, which may be cleared at any
+ * time). Hence, an update only recomputes the staircases of subdiagrams
+ * touched by the new points.
+ **/
+class IncrementalInterpolation {
+  typedef IncrementalInterpolation self;
+
+public:
+  /// Construct for points, which are divisors of variables
+  IncrementalInterpolation(const Monomial& variables);
+
+  /// Add points, at which the function has value zero
+  void addZeros(const MonomialSet& points);
+  void addZeros(const std::vector<Exponent>& points);
+
+  /// Add points, at which the function has value one
+  void addOnes(const MonomialSet& points);
+  void addOnes(const std::vector<Exponent>& points);
+
+  /// Points with function values zero and one, respectively
+  const MonomialSet& toZero() const { return m_to_zero; }
+  const MonomialSet& toOne() const { return m_to_one; }
+
+  /// All points seen so far
+  MonomialSet points() const { return m_to_zero.unite(m_to_one); }
+
+  /// Interpolating polynomial with smallest terms (w.r.t. lex)
+  Polynomial interpolation() const;
+
+  /// Standard monomials of the vanishing ideal of the points (w.r.t. lex)
+  const MonomialSet& standardMonomials() const { return m_standards; }
+
+  /// Leading terms of the Groebner basis of the vanishing ideal
+  MonomialSet leadingTerms() const;
+
+  /// Reduced lexicographical Groebner basis of the vanishing ideal
+  std::vector<Polynomial> groebnerBasis() const;
+
+protected:
+  /// Unite points with target, which must not intersect other
+  void add(MonomialSet& target, const MonomialSet& other,
+           const MonomialSet& points);
+
+  /// Diagram of points
+  MonomialSet pointSet(const std::vector<Exponent>& points) const;
+
+  /// Points (keeping the key node alive) and their staircase by node
+  typedef std::map<MonomialSet::navigator,
+                   std::pair<MonomialSet, MonomialSet> > staircase_map;
+
+  /// Staircase of points (Cerlienco-Mureddu), reusing those of the last
+  /// update and recording the ones used now in current
+  MonomialSet staircase(const MonomialSet& points, staircase_map& current);
+
+private:
+  Monomial m_variables;
+  MonomialSet m_to_zero, m_to_one, m_standards;
+  staircase_map m_staircases;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_IncrementalInterpolation_h_ */
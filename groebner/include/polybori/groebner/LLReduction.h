@@ -18,12 +18,16 @@
 
 // include basic definitions
 #include "groebner_defs.h"
+#include <polybori/diagram/CDDForkJoin.h>
 
 BEGIN_NAMESPACE_PBORIGB
 
 /** @class LLReduction
  * @brief This class defines LLReduction.
  *
+ * The then- and else-branches of the recursion are independent. Given a
+ * positive fork depth, the top-most levels are scheduled into a
+ * @c CDDForkJoin and the remaining subproblems are reduced in parallel.
  **/
 template <bool have_redsb, bool single_call_for_noredsb,
           bool fast_multiplication>
@@ -44,7 +48,44 @@ public:
 
   Polynomial operator()(const Polynomial& p, MonomialSet::navigator r_nav);
 
+  /// Reduce in parallel below the top-most @c depth levels
+  /// @note Polynomials with less than @c cutoff nodes are reduced serially.
+  Polynomial operator()(const Polynomial& p, MonomialSet::navigator r_nav,
+                        unsigned depth, CDDForkJoin::size_type cutoff =
+                        CDDForkJoin::default_cutoff) {
+    if ((depth == 0) || (p.set().nNodes() < cutoff))
+      return operator()(p, r_nav);
+
+    CDDForkJoin forks(p.ring(), &reduce);
+    return operator()(forks, p, r_nav, depth, cutoff);
+  }
+
+  /// Reduce in parallel below the top-most @c depth levels using @c forks
+  /// (for the reductions as well as for the multiplications of the results)
+  Polynomial operator()(CDDForkJoin& forks, const Polynomial& p,
+                        MonomialSet::navigator r_nav, unsigned depth,
+                        CDDForkJoin::size_type cutoff =
+                        CDDForkJoin::default_cutoff) {
+    if ((depth == 0) || (p.set().nNodes() < cutoff))
+      return operator()(p, r_nav);
+
+    CDDForkJoin::deferred_type result = fork(forks, p, r_nav, depth, cutoff);
+    forks.join();
+    return result();
+  }
+
 protected:
+  /// Serial reduction (in worker threads, on worker rings)
+  static Polynomial
+  reduce(const Polynomial& poly, const Polynomial& reductors) {
+    return LLReduction(poly.ring())(poly, reductors.navigation());
+  }
+
+  /// Schedule the top-most @c depth levels of the reduction into @c forks
+  CDDForkJoin::deferred_type fork(CDDForkJoin& forks, const Polynomial& p,
+                                  MonomialSet::navigator r_nav, unsigned depth,
+                                  CDDForkJoin::size_type cutoff);
+
   typedef PBORI::CacheManager<CCacheTypes::ll_red_nf> cache_mgr_type;
   cache_mgr_type cache_mgr;
 };
@@ -106,6 +147,71 @@ LLReduction<have_redsb, single_call_for_noredsb,
   return res;
 }
 
+template <bool have_redsb, bool single_call_for_noredsb, bool fast_multiplication>
+CDDForkJoin::deferred_type
+LLReduction<have_redsb, single_call_for_noredsb,
+            fast_multiplication>::fork(CDDForkJoin& forks, const Polynomial& p,
+                                       MonomialSet::navigator r_nav,
+                                       unsigned depth,
+                                       CDDForkJoin::size_type cutoff) {
+
+  if PBORI_UNLIKELY(p.isConstant()) return CDDForkJoin::value(p);
+
+  MonomialSet::navigator p_nav=p.navigation();
+  idx_type p_index=*p_nav;
+
+  while((*r_nav)<p_index) {
+    r_nav.incrementThen();
+  }
+
+  if PBORI_UNLIKELY(r_nav.isConstant())
+    return CDDForkJoin::value(p);
+
+  if (depth == 0)
+    return forks.fork(&reduce, p, cache_mgr.generate(r_nav));
+
+  Polynomial p_nav_else(cache_mgr.generate(p_nav.elseBranch()));
+  Polynomial p_nav_then(cache_mgr.generate(p_nav.thenBranch()));
+
+  if ((*r_nav) == p_index){
+    Polynomial r_nav_else(cache_mgr.generate(r_nav.elseBranch()));
+
+    if ((!have_redsb) && single_call_for_noredsb) {
+      Polynomial product =
+        dd_multiply_forked<fast_multiplication>(forks, r_nav_else, p_nav_then,
+                                                depth, cutoff);
+      return fork(forks, p_nav_else + product, r_nav.thenBranch(), depth - 1,
+                  cutoff);
+    }
+
+    CDDForkJoin::deferred_type tmp1 =
+      fork(forks, p_nav_else, r_nav.thenBranch(), depth - 1, cutoff);
+    CDDForkJoin::deferred_type tmp2 =
+      fork(forks, p_nav_then, r_nav.thenBranch(), depth - 1, cutoff);
+    CDDForkJoin::deferred_type tmp( have_redsb? CDDForkJoin::value(r_nav_else):
+      fork(forks, r_nav_else, r_nav.thenBranch(), depth - 1, cutoff) );
+
+    // the products are computed (after the join) in the same forks
+    CDDForkJoin* context = &forks;
+    return [tmp1, tmp2, tmp, context, depth, cutoff]() {
+      return tmp1() +
+        dd_multiply_forked<fast_multiplication>(*context, tmp(), tmp2(),
+                                                depth, cutoff);
+    };
+  }
+
+  PBORI_ASSERT((*r_nav)>p_index);
+  CDDForkJoin::deferred_type then_branch =
+    fork(forks, p_nav_then, r_nav, depth - 1, cutoff);
+  CDDForkJoin::deferred_type else_branch =
+    fork(forks, p_nav_else, r_nav, depth - 1, cutoff);
+
+  return [p_index, then_branch, else_branch]() {
+    return Polynomial(MonomialSet(p_index, then_branch().diagram(),
+                                  else_branch().diagram()));
+  };
+}
+
 END_NAMESPACE_PBORIGB
 
 #endif /* polybori_LLReduction_h_ */
@@ -17,6 +17,7 @@
 #define polybori_groebner_LLReductor_h_
 
 #include "ll_red_nf.h"
+#include "LLSubstitution.h"
 
 // include basic definitions
 #include "groebner_defs.h"
@@ -38,11 +39,22 @@ class LLReductor:
   typedef LLReductor self;
 public:
   /// Construct reductor from Ring
-  LLReductor(const BoolePolyRing& ring): base(ring.one()) {}
+  LLReductor(const BoolePolyRing& ring): base(ring.one()), m_table() {}
 
   /// Construct copy or MonomialSet
   template <class Type>
-  LLReductor(const Type& value): base(value) { PBORI_ASSERT(!isZero()); }
+  LLReductor(const Type& value): base(value), m_table() {
+    PBORI_ASSERT(!isZero());
+  }
+
+  /// Reduce by substituting all eliminated variables at once
+  /// @note Equivalent to @c ll_red_nf(p, *this), but uses a precompiled
+  /// substitution table, which is compiled on first use after changes.
+  Polynomial substitute(const Polynomial& p) const {
+    if (!m_table || !m_table->compiledFrom(*this))
+      m_table.reset(new LLSubstitution(*this));
+    return (*m_table)(p);
+  }
 
 
   /// Test whether polynomial is a compatible reductor element
@@ -75,6 +87,8 @@ private:
     return poly;
   }
 
+  /// Substitution table (shared by copies with the same reductors)
+  mutable std::shared_ptr<LLSubstitution> m_table;
 };
 
 END_NAMESPACE_PBORIGB
@@ -0,0 +1,82 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file LLSubstitution.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c LLSubstitution.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_LLSubstitution_h_
+#define polybori_groebner_LLSubstitution_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+
+#include <vector>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class LLSubstitution
+ * @brief This class defines a precompiled form of a (fully reduced) set of
+ * linear-lead reductors, as encoded by @c LLReductor.
+ *
+ * It stores the replacement polynomial for every eliminated variable and
+ * substitutes all of them in a single pass over the input. Intermediate
+ * results are cached in the computed table of the ring (keyed by the node and
+ * the reductors), hence they neither keep diagrams alive nor outlive
+ * @c BoolePolyRing::clearCache(). It is equivalent to
+ * @c ll_red_nf(p, reductors).
+ **/
+class LLSubstitution {
+  typedef LLSubstitution self;
+
+public:
+  typedef MonomialSet::navigator navigator;
+  typedef std::size_t size_type;
+
+  /// Construct from reductors (as encoded by @c LLReductor)
+  LLSubstitution(const MonomialSet& reductors);
+
+  /// Check whether the table was compiled from given reductors
+  bool compiledFrom(const MonomialSet& reductors) const {
+    return m_reductors.navigation() == reductors.navigation();
+  }
+
+  /// Number of eliminated variables
+  size_type size() const { return m_count; }
+
+  /// Substitute all eliminated variables in @c p
+  Polynomial operator()(const Polynomial& p) const;
+
+  /// Check whether the result for @c p is currently cached
+  bool cached(const Polynomial& p) const;
+
+protected:
+  typedef PBORI::CacheManager<CCacheTypes::ll_substitution> cache_mgr_type;
+
+  /// Substitute recursively
+  MonomialSet substitute(const cache_mgr_type& cache_mgr, navigator navi) const;
+
+  /// Lookup replacement of variable (null if not eliminated)
+  const MonomialSet* replacement(idx_type idx) const {
+    return ((idx < (idx_type)m_replacements.size()) && m_eliminated[idx] ?
+            &m_replacements[idx]: NULL);
+  }
+
+private:
+  MonomialSet m_reductors;
+  std::vector<MonomialSet> m_replacements;
+  std::vector<bool> m_eliminated;
+  size_type m_count;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_LLSubstitution_h_ */
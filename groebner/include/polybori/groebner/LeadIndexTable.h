@@ -0,0 +1,192 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file LeadIndexTable.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c LeadIndexTable.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_LeadIndexTable_h_
+#define polybori_groebner_LeadIndexTable_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+#include <vector>
+#include <functional>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class LeadNodeHasher
+ * @brief Hashes the (canonical) root node of a leading monomial.
+ *
+ * Since the ZDD manager keeps nodes unique, the node address identifies the
+ * monomial completely. Fibonacci hashing spreads the aligned addresses.
+ **/
+class LeadNodeHasher {
+public:
+  typedef Monomial::dd_type::node_ptr node_ptr;
+
+  std::size_t operator()(node_ptr node) const {
+    std::size_t value = reinterpret_cast<std::size_t>(node) >> 4;
+    value *= static_cast<std::size_t>(0x9E3779B97F4A7C15ULL);
+    return value ^ (value >> (4 * sizeof(std::size_t)));
+  }
+};
+
+/** @class LeadExpHasher
+ * @brief Hashes leading exponents (fallback for lookups by @c Exponent).
+ **/
+class LeadExpHasher {
+public:
+  std::size_t operator()(const Exponent& exp) const {
+    return static_cast<std::size_t>(exp.stableHash());
+  }
+};
+
+/** @class LeadIndexTable
+ * @brief Open-addressing hash table mapping keys to (generator) indices.
+ *
+ * Linear probing on a power-of-two sized slot array with stored hash values,
+ * so that a lookup touches one contiguous memory region and compares keys
+ * only on hash collisions. Since indices are dense, the slot of each index is
+ * tracked, which makes erasing by index possible without knowing the key.
+ **/
+template <class KeyType, class HasherType,
+          class EqualType = std::equal_to<KeyType> >
+class LeadIndexTable {
+
+public:
+  typedef idx_type data_type;
+  typedef std::size_t size_type;
+
+  LeadIndexTable(): m_slots(), m_positions(), m_used(0), m_filled(0) {}
+
+  /// Find index associated to @c key, returns -1 if key is invalid
+  data_type find(const KeyType& key) const {
+    if PBORI_UNLIKELY(m_slots.empty())
+      return not_found;
+
+    const size_type hash = HasherType()(key);
+    const size_type mask = m_slots.size() - 1;
+    for (size_type pos = hash & mask; ; pos = (pos + 1) & mask) {
+      const slot_type& slot = m_slots[pos];
+      if (slot.index == not_found)
+        return not_found;
+      if ((slot.index != removed) && (slot.hash == hash) &&
+          EqualType()(slot.key, key))
+        return slot.index;
+    }
+  }
+
+  /// Associate @c key with @c index (overwriting previous associations)
+  void insert(const KeyType& key, data_type index) {
+    PBORI_ASSERT(index >= 0);
+    if PBORI_UNLIKELY(2 * (m_filled + 1) > m_slots.size())
+      rehash();
+
+    const size_type hash = HasherType()(key);
+    const size_type mask = m_slots.size() - 1;
+    size_type target = size_type(-1);
+    size_type pos = hash & mask;
+
+    for (; m_slots[pos].index != not_found; pos = (pos + 1) & mask) {
+      slot_type& slot = m_slots[pos];
+      if (slot.index == removed) {
+        if (target == size_type(-1))
+          target = pos;
+      }
+      else if ((slot.hash == hash) && EqualType()(slot.key, key)) {
+        position(slot.index) = size_type(-1);
+        slot.index = index;
+        position(index) = pos;
+        return;
+      }
+    }
+
+    if (target == size_type(-1)) {
+      target = pos;
+      ++m_filled;
+    }
+    slot_type& slot = m_slots[target];
+    slot.hash = hash;
+    slot.key = key;
+    slot.index = index;
+    position(index) = target;
+    ++m_used;
+  }
+
+  /// Remove the entry associated to @c index (if any)
+  void erase(data_type index) {
+    if ((size_type)index >= m_positions.size())
+      return;
+
+    size_type& pos = m_positions[index];
+    if ((pos == size_type(-1)) || (m_slots[pos].index != index))
+      return;
+
+    m_slots[pos].index = removed;
+    m_slots[pos].key = KeyType();
+    pos = size_type(-1);
+    --m_used;
+  }
+
+  /// Number of valid entries
+  size_type size() const { return m_used; }
+
+private:
+  enum { not_found = -1, removed = -2 };
+
+  struct slot_type {
+    slot_type(): hash(0), key(), index(not_found) {}
+
+    size_type hash;
+    KeyType key;
+    data_type index;
+  };
+
+  size_type& position(data_type index) {
+    if ((size_type)index >= m_positions.size())
+      m_positions.resize(2 * index + 1, size_type(-1));
+    return m_positions[index];
+  }
+
+  /// Grow (or just clean up removed slots), keeping a load factor below 1/2
+  void rehash() {
+    size_type capacity = 16;
+    while (capacity < 4 * (m_used + 1))
+      capacity *= 2;
+
+    std::vector<slot_type> old(capacity);
+    old.swap(m_slots);
+    m_used = m_filled = 0;
+
+    const size_type mask = capacity - 1;
+    for (typename std::vector<slot_type>::iterator start(old.begin());
+         start != old.end(); ++start) {
+      if (start->index >= 0) {
+        size_type pos = start->hash & mask;
+        while (m_slots[pos].index != not_found)
+          pos = (pos + 1) & mask;
+        m_slots[pos] = *start;
+        m_positions[start->index] = pos;
+        ++m_used;
+        ++m_filled;
+      }
+    }
+  }
+
+  std::vector<slot_type> m_slots;
+  std::vector<size_type> m_positions;
+  size_type m_used, m_filled;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_LeadIndexTable_h_ */
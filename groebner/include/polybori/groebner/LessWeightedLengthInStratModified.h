@@ -18,19 +18,10 @@
 
 // include basic definitions
 #include "groebner_defs.h"
+#include "PolyEntry.h"
 
 BEGIN_NAMESPACE_PBORIGB
 
-inline wlen_type wlen_literal_exceptioned(const PolyEntry& e){
-    wlen_type res=e.weightedLength;
-    if ((e.deg==1) && (e.length<=4)){
-        //if (e.length==1) return -1;
-        //if (e.p.hasConstantPart()) return 0;
-        return res-1;
-    }
-    return res;
-}
-
 /** @class LessWeightedLengthInStratModified
  * @brief This class defines LessWeightedLengthInStratModified.
  *
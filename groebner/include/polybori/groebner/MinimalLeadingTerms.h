@@ -18,12 +18,16 @@
 
 // include basic definitions
 #include "groebner_defs.h"
+#include "CopyOnWrite.h"
+#include "DivisorSignatureIndex.h"
 
 BEGIN_NAMESPACE_PBORIGB
 
 /** @class MinimalLeadingTerms
  * @brief This class defines MinimalLeadingTerms.
  *
+ * A @c DivisorSignatureIndex of the terms is maintained alongside, which
+ * answers most negative divisibility queries without touching the diagram.
  **/
 
 class MinimalLeadingTerms:
@@ -34,7 +38,22 @@ class MinimalLeadingTerms:
 
 public:
   template <class Type>
-  MinimalLeadingTerms(const Type& value): base(value) { }
+  MinimalLeadingTerms(const Type& value): base(value), m_index() {
+    for (exp_iterator start(expBegin()); start != expEnd(); ++start)
+      m_index.mutate().insert(*start);
+  }
+
+  /// Check, whether some element divides lm (like @c hasTermOfVariables)
+  bool containsDivisorOf(const Monomial& lm) const {
+    return m_index->mayDivide(lm.begin(), lm.end()) &&
+      hasTermOfVariables(lm);
+  }
+
+  /// Check, whether some element divides exp
+  bool containsDivisorOf(const Exponent& exp) const {
+    return m_index->mayDivide(exp.begin(), exp.end()) &&
+      !divisorsOf(exp).isZero();
+  }
 
   /// Insert leading term and return monomials, that are not minimal (any more)
   MonomialSet update(const Monomial& lm) {
@@ -48,7 +67,15 @@ public:
   
 private:
   self& operator=(const self& rhs) {
-    return static_cast<self&>(static_cast<base&>(*this) = rhs);
+    static_cast<base&>(*this) = rhs;
+    m_index = rhs.m_index;
+    return *this;
+  }
+
+  /// Assign terms only (the index is updated by the caller)
+  self& operator=(const base& rhs) {
+    static_cast<base&>(*this) = rhs;
+    return *this;
   }
 
   MonomialSet cleanup(const Monomial& lm) {
@@ -58,6 +85,12 @@ private:
     PBORI_ASSERT(assertion(lm, removed.expBegin(),removed.expEnd()));
 
     *this = diff(removed).unite(lm.set());
+
+    DivisorSignatureIndex& index = m_index.mutate();
+    for (exp_iterator start(removed.expBegin()); start != removed.expEnd();
+         ++start)
+      index.erase(*start);
+    index.insert(lm.exp());
     return removed;
   }
   
@@ -71,6 +104,8 @@ private:
     }
     return true;
   }
+
+  CopyOnWrite<DivisorSignatureIndex> m_index;
 };
 
 END_NAMESPACE_PBORIGB
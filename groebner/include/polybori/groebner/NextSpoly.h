@@ -19,12 +19,20 @@
 // include basic definitions
 #include "groebner_defs.h"
 #include "ReductionStrategy.h"
+#include <polybori/diagram/CDDForkJoin.h>
+
+#include <vector>
 
 BEGIN_NAMESPACE_PBORIGB
 
 /** @class NextSpoly
  * @brief This class computes the next spoly for a generator pair.
  *
+ * Selection (which updates the pair status) and construction of the
+ * S-polynomial are separated, so that a whole batch of pairs can be selected
+ * first and constructed independently afterwards. For large generators, the
+ * products of a batch are computed in parallel by a @c CDDForkJoin; the
+ * results are assembled in the order of the batch.
  **/
 
 class NextSpoly {
@@ -34,35 +42,104 @@ public:
     m_gen(gen), m_status(status) {}
 
   Polynomial operator()(const Pair& act_pair) {
-    return compute(act_pair, act_pair.extract(m_gen));
+    return construct(select(act_pair));
   }
 
-protected:
-  Polynomial compute(const Pair& act_pair, const Polynomial& result) {
+  /// Update the pair status (in order) and return the pair to be constructed
+  Pair select(const Pair& act_pair) {
     if (act_pair.getType() == IJ_PAIR)
-      return compute(act_pair.ijPair(), result);
+      return select(act_pair, act_pair.ijPair());
     else
       if (act_pair.getType() == VARIABLE_PAIR)
-        return compute(act_pair.variablePair(), result);
+        m_gen(act_pair.variablePair().i).vPairCalculated.insert(
+          act_pair.variablePair().v);
     
+    return act_pair;
+  }
+
+  /// Construct S-polynomial of a selected pair (without any status changes)
+  Polynomial construct(const Pair& act_pair) const {
+    Polynomial result = act_pair.extract(m_gen);
+
+    if (act_pair.getType() == VARIABLE_PAIR) {
+      const PolyEntry& entry = m_gen[act_pair.variablePair().i];
+      if (!result.isZero() && (result.lead() == entry.lead))
+        result += entry.p;
+    }
     return result;
   }
 
-  Polynomial compute(const IJPairData& ij, const Polynomial& res) {
+  /// Construct S-polynomials of selected pairs [start, finish) into result,
+  /// products of generators having at least @c cutoff nodes are computed by
+  /// @c forks in parallel
+  template <class Iterator>
+  void construct(Iterator start, Iterator finish,
+                 std::vector<Polynomial>& result, CDDForkJoin& forks,
+                 CDDForkJoin::size_type cutoff =
+                 CDDForkJoin::default_cutoff) const {
+
+    std::vector<CDDForkJoin::deferred_type> spolys;
+    for (; start != finish; ++start)
+      spolys.push_back(fork(*start, forks, cutoff));
+    forks.join();
+
+    result.reserve(result.size() + spolys.size());
+    for (std::vector<CDDForkJoin::deferred_type>::const_iterator
+           iter(spolys.begin()); iter != spolys.end(); ++iter)
+      result.push_back((*iter)());
+    forks.clear();
+  }
+
+protected:
+  /// Schedule the products of the S-polynomial of a selected pair
+  CDDForkJoin::deferred_type fork(const Pair& act_pair, CDDForkJoin& forks,
+                                  CDDForkJoin::size_type cutoff) const {
+    CDDForkJoin::operation_type multiply =
+      [](const Polynomial& lhs, const Polynomial& rhs) { return lhs * rhs; };
+
+    if (act_pair.getType() == IJ_PAIR) {
+      const PolyEntry& first = m_gen[act_pair.ijPair().i];
+      const PolyEntry& second = m_gen[act_pair.ijPair().j];
+      if (first.p.set().nNodes() + second.p.set().nNodes() < cutoff)
+        return CDDForkJoin::value(construct(act_pair));
+
+      // same as spoly(first.p, second.p)
+      Monomial prod = first.lead * second.lead;
+      CDDForkJoin::deferred_type lhs =
+        forks.fork(multiply, first.p, prod / first.lead);
+      CDDForkJoin::deferred_type rhs =
+        forks.fork(multiply, second.p, prod / second.lead);
+      return [lhs, rhs]() { return lhs() + rhs(); };
+    }
+
+    if (act_pair.getType() == VARIABLE_PAIR) {
+      const PolyEntry& entry = m_gen[act_pair.variablePair().i];
+      if (entry.p.set().nNodes() < cutoff)
+        return CDDForkJoin::value(construct(act_pair));
+
+      CDDForkJoin::deferred_type product =
+        forks.fork(multiply, entry.p,
+                   Variable(act_pair.variablePair().v, entry.p.ring()));
+      return [product, &entry]() {
+        Polynomial result = product();
+        if (!result.isZero() && (result.lead() == entry.lead))
+          result += entry.p;
+        return result;
+      };
+    }
+
+    return CDDForkJoin::value(construct(act_pair));
+  }
+
+  Pair select(const Pair& act_pair, const IJPairData& ij) {
     int i = ij.i, j = ij.j;
     replacePair(i, j);
     m_status.setToHasTRep(ij.i, ij.j);
     if ((i != ij.i) || (ij.j != j)){
       m_status.setToHasTRep(i,j);
-      return spoly(m_gen[i].p, m_gen[j].p);
+      return Pair(i, j, m_gen);
     }
-    return res;
-  }
-
-  Polynomial compute(const VariablePairData& vp, const Polynomial& res) {
-    m_gen(vp.i).vPairCalculated.insert(vp.v);
-    return (!res.isZero() && (res.lead() == m_gen[vp.i].lead)?
-            res + m_gen[vp.i].p: res);
+    return act_pair;
   }
 
   void replacePair(int& first, int& second) {
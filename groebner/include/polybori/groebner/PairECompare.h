@@ -18,6 +18,7 @@
 
 // include basic definitions
 #include "groebner_defs.h"
+#include "ExpOrderDispatch.h"
 
 BEGIN_NAMESPACE_PBORIGB
 
@@ -25,22 +26,23 @@ BEGIN_NAMESPACE_PBORIGB
  * @brief This class defines PairECompare.
  *
  **/
-class PairECompare: 
-  public CFactoryBase {
+class PairECompare {
 public:
   PairECompare(const BoolePolyRing& ring):
-    CFactoryBase(ring) {}
+    m_compare(ring) {}
 
   ///replaces less template
   bool operator() (const PairE& l, const PairE& r){
     if (l.sugar!=r.sugar) return l.sugar>r.sugar; //greater sugar, less importance
     if (l.wlen!=r.wlen) return l.wlen>r.wlen;
-    if (l.lm!=r.lm) return parent().ordering().compare(l.lm, r.lm) 
-		      == CTypes::greater_than;
+    if (l.lm!=r.lm) return m_compare(l.lm, r.lm) == CTypes::greater_than;
     
     ///@todo lm comparison
     return false;
   }
+
+private:
+  DispatchedExpCompare m_compare;
 };
 
 END_NAMESPACE_PBORIGB
@@ -17,6 +17,7 @@
 #define polybori_groebner_PairManager_h_
 
 #include "PairStatusSet.h"
+#include "PairQueue.h"
 
 
 // include basic definitions
@@ -38,8 +39,7 @@ class PairManager {
   typedef PairManager self;
 
 public:
-  typedef std::priority_queue<Pair, std::vector<PairE>, PairECompare>
-  queue_type;
+  typedef PairQueue queue_type;
 
   PairManager(const BoolePolyRing& ring):
     queue(ring)  { }
@@ -63,6 +63,12 @@ public:
     return NextSpoly(gen, status)(popped());
   }
 
+  /// Pop next pair and update status, the S-polynomial is constructed later
+  Pair nextPair(ReductionStrategy& gen) {
+    PBORI_ASSERT(!pairSetEmpty());
+    return NextSpoly(gen, status).select(popped());
+  }
+
   bool pairSetEmpty() const { return queue.empty(); }
 
   template <class StrategyType>
@@ -0,0 +1,147 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file PairQueue.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c PairQueue.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_PairQueue_h_
+#define polybori_groebner_PairQueue_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+#include "pairs.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class PairQueue
+ * @brief This class defines the priority queue of critical pairs.
+ *
+ * It has the interface of @c std::priority_queue, but it is implemented as
+ * a persistent leftist heap: copies share all nodes. Nodes owned by a single
+ * queue are changed in place, so @c push() and @c pop() do not copy anything
+ * unless the queue was copied. After a copy, only the (logarithmically many)
+ * shared nodes on the paths which are changed are cloned.
+ **/
+class PairQueue {
+  typedef PairQueue self;
+
+public:
+  typedef PairE value_type;
+  typedef std::size_t size_type;
+  typedef const value_type& const_reference;
+
+  /// Construct empty queue for pairs of the given ring
+  PairQueue(const BoolePolyRing& ring):
+    m_compare(ring), m_root(), m_size(0) { }
+
+  /// Copy constructor, shares all nodes with rhs
+  PairQueue(const self& rhs):
+    m_compare(rhs.m_compare), m_root(rhs.m_root), m_size(rhs.m_size) { }
+
+  /// Assignment, shares all nodes with rhs
+  self& operator=(const self& rhs) {
+    node_ptr old(m_root);
+    m_compare = rhs.m_compare;
+    m_root = rhs.m_root;
+    m_size = rhs.m_size;
+    release(old);
+    return *this;
+  }
+
+  /// Destructor (releases long paths without recursion)
+  ~PairQueue() { release(m_root); }
+
+  /// @name Interface of std::priority_queue
+  //@{
+  bool empty() const { return !m_root; }
+  size_type size() const { return m_size; }
+  const_reference top() const { PBORI_ASSERT(m_root); return m_root->value; }
+
+  void push(const value_type& pair) {
+    m_root = merge(std::move(m_root), std::make_shared<node_type>(pair));
+    ++m_size;
+  }
+
+  void pop() {
+    PBORI_ASSERT(m_root);
+    node_ptr root(std::move(m_root));
+    if (root.use_count() == 1)
+      m_root = merge(std::move(root->left), std::move(root->right));
+    else
+      m_root = merge(root->left, root->right);
+    --m_size;
+  }
+  //@}
+
+private:
+  struct node_type;
+  typedef std::shared_ptr<node_type> node_ptr;
+
+  /// Node of the heap, its rank is the length of its right-most path
+  struct node_type {
+    node_type(const value_type& value_):
+      value(value_), left(), right(), rank(1) { }
+
+    value_type value;
+    node_ptr left, right;
+    size_type rank;
+  };
+
+  static size_type rank(const node_ptr& node) {
+    return (node? node->rank: 0);
+  }
+
+  /// Merge heaps along the right-most paths, shared nodes are cloned
+  node_ptr merge(node_ptr lhs, node_ptr rhs) {
+    if (!lhs)
+      return rhs;
+    if (!rhs)
+      return lhs;
+
+    if (m_compare(lhs->value, rhs->value))
+      lhs.swap(rhs);
+    if (lhs.use_count() > 1)
+      lhs = std::make_shared<node_type>(*lhs);
+
+    lhs->right = merge(std::move(lhs->right), std::move(rhs));
+    if (rank(lhs->left) < rank(lhs->right))
+      lhs->left.swap(lhs->right);
+    lhs->rank = rank(lhs->right) + 1;
+    return lhs;
+  }
+
+  /// Release nodes iteratively (left paths may be long)
+  static void release(node_ptr& node) {
+    std::vector<node_ptr> nodes;
+    nodes.push_back(std::move(node));
+    while (!nodes.empty()) {
+      node_ptr current(std::move(nodes.back()));
+      nodes.pop_back();
+      if (current && (current.use_count() == 1)) {
+        nodes.push_back(std::move(current->left));
+        nodes.push_back(std::move(current->right));
+      }
+    }
+  }
+
+  PairECompare m_compare;
+  node_ptr m_root;
+  size_type m_size;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_PairQueue_h_ */
@@ -18,6 +18,7 @@
 
 // include basic definitions
 #include "groebner_defs.h"
+#include "CopyOnWrite.h"
 
 #include <boost/dynamic_bitset.hpp>
 
@@ -26,21 +27,24 @@ BEGIN_NAMESPACE_PBORIGB
 /** @class PairStatusSet
  * @brief This class defines PairStatusSet.
  *
+ * The rows of the table are shared copy-on-write, so copying the set is
+ * cheap and a copy only clones the rows it changes.
  **/
 class PairStatusSet{
 public:
   typedef boost::dynamic_bitset<> bitvector_type;
+  typedef CopyOnWrite<bitvector_type> row_type;
   bool hasTRep(int ia, int ja) const {
     int i,j;
     i=std::min(ia,ja);
     j=std::max(ia,ja);
-    return table[j][i]==HAS_T_REP;
+    return table.get()[j].get()[i]==HAS_T_REP;
   }
   void setToHasTRep(int ia, int ja){
     int i,j;
     i=std::min(ia,ja);
     j=std::max(ia,ja);
-    table[j][i]=HAS_T_REP;
+    table.mutate()[j].mutate()[i]=HAS_T_REP;
   }
 
   template <class Iterator>
@@ -52,7 +56,7 @@ public:
     int i,j;
     i=std::min(ia,ja);
     j=std::max(ia,ja);
-    table[j][i]=UNCALCULATED;
+    table.mutate()[j].mutate()[i]=UNCALCULATED;
   }
 
   template <class Iterator>
@@ -62,8 +66,8 @@ public:
   }
 
   int prolong(bool value=UNCALCULATED){
-    int s=table.size();
-    table.push_back(bitvector_type(s, value));
+    int s=table.get().size();
+    table.mutate().push_back(row_type(bitvector_type(s, value)));
     return s;
   }
   PairStatusSet(int size=0){
@@ -76,7 +80,7 @@ public:
   static const bool UNCALCULATED=false;
 
 protected:
-std::vector<bitvector_type> table;
+CopyOnWrite<std::vector<row_type> > table;
 };
 
 END_NAMESPACE_PBORIGB
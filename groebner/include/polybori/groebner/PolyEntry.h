@@ -70,6 +70,15 @@ public:
 
 
 
+inline wlen_type wlen_literal_exceptioned(const PolyEntry& e){
+    wlen_type res=e.weightedLength;
+    if ((e.deg==1) && (e.length<=4)){
+        //if (e.length==1) return -1;
+        //if (e.p.hasConstantPart()) return 0;
+        return res-1;
+    }
+    return res;
+}
 
 inline bool
 should_propagate(const PolyEntry& e){
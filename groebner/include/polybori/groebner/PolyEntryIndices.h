@@ -19,6 +19,9 @@
 // include basic definitions
 #include "groebner_defs.h"
 #include "PolyEntry.h"
+#include "LeadIndexTable.h"
+
+#include <vector>
 
 BEGIN_NAMESPACE_PBORIGB
 
@@ -28,6 +31,12 @@ typedef Exponent::idx_map_type exp2Index_map_type;
 /** @class PolyEntryIndices
  * @brief This class defines PolyEntryIndices.
  *
+ * Leading monomials are canonical ZDD nodes, hence they are looked up by
+ * their root node in a flat hash table. Lookups by exponent are served by a
+ * second table (no temporary @c Exponent is constructed for monomial keys).
+ *
+ * Additionally, the weights used for selecting reductors are stored per index
+ * and a revision number is increased on each change of the entries.
  **/
 
 class PolyEntryIndices {
@@ -36,33 +45,49 @@ class PolyEntryIndices {
   class uncheck {};
 
 public:
-  typedef Monomial::idx_map_type lm2Index_map_type;
-  typedef Exponent::idx_map_type exp2Index_map_type;
-  typedef lm2Index_map_type::value_type value_type;
-  typedef value_type::second_type data_type;
+  typedef Monomial::dd_type::node_ptr node_ptr;
+  typedef LeadIndexTable<node_ptr, LeadNodeHasher> lm2Index_table_type;
+  typedef LeadIndexTable<Exponent, LeadExpHasher> exp2Index_table_type;
+  typedef lm2Index_table_type::data_type data_type;
+  typedef std::size_t revision_type;
 
   PolyEntryIndices():
-    lm2Index(), exp2Index() {}
+    lm2Index(), exp2Index(), m_weights(), m_literal_weights(),
+    m_revision(0) {}
 
   /// Consistently inserting element @todo for some reason not inlinable
   void insert(const PolyEntry& entry, const data_type& rhs) {
-    exp2Index[entry.leadExp] = rhs;
-    lm2Index[entry.lead] = rhs;
+    exp2Index.insert(entry.leadExp, rhs);
+    lm2Index.insert(node(entry.lead), rhs);
+    setWeights(entry, rhs);
   }
 
   /// Consistently replacing keys
   void update(const Monomial& key, const PolyEntry& entry) {
 
     if PBORI_UNLIKELY(entry.lead != key) {
-      lm2Index_map_type::iterator lm_pos = lm2Index.find(key);
-      PBORI_ASSERT(lm_pos != lm2Index.end());
-      lm2Index[entry.lead] = lm_pos->second;
-      exp2Index[entry.leadExp] = lm_pos->second;
-      lm2Index.erase(lm_pos);
-      exp2Index.erase(exp2Index.find(key.exp()));
+      data_type idx = lm2Index.find(node(key));
+      PBORI_ASSERT(idx != data_type(-1));
+      lm2Index.erase(idx);
+      exp2Index.erase(idx);
+      lm2Index.insert(node(entry.lead), idx);
+      exp2Index.insert(entry.leadExp, idx);
     }
+    setWeights(entry, lm2Index.find(node(entry.lead)));
+  }
+
+  /// Weighted length of the element with given index
+  wlen_type weightedLength(data_type idx) const { return m_weights[idx]; }
+
+  /// Weighted length, which prefers short linear elements
+  /// (see @c wlen_literal_exceptioned)
+  wlen_type literalWeightedLength(data_type idx) const {
+    return m_literal_weights[idx];
   }
 
+  /// Changes whenever an element is inserted or updated
+  revision_type revision() const { return m_revision; }
+
   /// Lookup indices @note could fail for invalid keys
   template <class KeyType>
   data_type operator()(const KeyType& key) const {
@@ -77,6 +102,18 @@ public:
 
 protected:
 
+  static node_ptr node(const Monomial& key) { return key.diagram().getNode(); }
+
+  void setWeights(const PolyEntry& entry, data_type idx) {
+    PBORI_ASSERT(idx >= 0);
+    if ((std::size_t)idx >= m_weights.size()) {
+      m_weights.resize(idx + 1);
+      m_literal_weights.resize(idx + 1);
+    }
+    m_weights[idx] = entry.weightedLength;
+    m_literal_weights[idx] = wlen_literal_exceptioned(entry);
+    ++m_revision;
+  }
 
   template <class CheckType>
   data_type get(data_type key, CheckType) const { return key; }
@@ -88,37 +125,32 @@ protected:
 
   template <class CheckType>
   data_type get(const Monomial& key, CheckType dummy) const {
-    return get(lm2Index, key, dummy);
+    return get(lm2Index, node(key), dummy);
   }
 
   template <class CheckType>
   data_type get(const PolyEntry& key, CheckType dummy) const {
-    return get(lm2Index, key.lead, dummy);
+    return get(lm2Index, node(key.lead), dummy);
   }
 
-  template <class MapType, class KeyType>
-  data_type get(const MapType& map, const KeyType& key, check) const {
-
-    typename MapType::const_iterator result(map.find(key));
-
-    if (result == map.end())
-      return (data_type)-1;
-
-    PBORI_ASSERT(result->second != data_type(-1));
-    return result->second;
+  template <class TableType, class KeyType>
+  data_type get(const TableType& table, const KeyType& key, check) const {
+    return table.find(key);
   }
 
-  template <class MapType, class KeyType>
-  data_type get(const MapType& map, const KeyType& key, uncheck) const {
+  template <class TableType, class KeyType>
+  data_type get(const TableType& table, const KeyType& key, uncheck) const {
 
-    typename MapType::const_iterator result(map.find(key));
-    PBORI_ASSERT(result != map.end());
-    return result->second;
+    data_type result = table.find(key);
+    PBORI_ASSERT(result != data_type(-1));
+    return result;
   }
 
 private:
-  lm2Index_map_type lm2Index;
-  exp2Index_map_type exp2Index;
+  lm2Index_table_type lm2Index;
+  exp2Index_table_type exp2Index;
+  std::vector<wlen_type> m_weights, m_literal_weights;
+  revision_type m_revision;
 };
 
 
@@ -22,6 +22,7 @@
 
 #include "PolyEntryIndices.h"
 #include "PolyEntry.h"
+#include "CopyOnWrite.h"
 
 BEGIN_NAMESPACE_PBORIGB
 
@@ -35,7 +36,7 @@ class PolyEntryReference {
   typedef PolyEntryReference self;
 
 public:
-  typedef PolyEntryIndices vector_type;
+  typedef CopyOnWrite<PolyEntryIndices> vector_type;
   typedef PolyEntry value_type;
 
   /// Construct from plain non-constant reference
@@ -64,7 +65,7 @@ public:
   self& operator=(const Type& rhs) {
     Monomial lm(m_entry.lead);
     m_entry = rhs;
-    m_parent.update(lm, m_entry);
+    m_parent.mutate().update(lm, m_entry);
     return *this;
   }
 
@@ -19,30 +19,42 @@
 #include "PolyEntryReference.h"
 #include "PolyEntryIndices.h"
 #include "PolyEntry.h"
+#include "CopyOnWrite.h"
 
 // include basic definitions
 #include "groebner_defs.h"
 
+#include <boost/iterator/indirect_iterator.hpp>
+
 BEGIN_NAMESPACE_PBORIGB
 
+/** @class PolyEntryVector
+ * @brief This class defines a vector of @c PolyEntry elements, indexed by
+ * their leading terms.
+ *
+ * Entries and indices are shared copy-on-write, so copies (e.g. snapshots for
+ * branching) are cheap and only clone the entries, which are modified later.
+ **/
 class PolyEntryVector {
-  typedef std::vector<PolyEntry> data_type;
+  typedef CopyOnWrite<PolyEntry> entry_type;
+  typedef std::vector<entry_type> data_type;
 
 public:
   /// Vector-style interface
   //@{
-  typedef data_type::value_type value_type;
+  typedef PolyEntry value_type;
   typedef data_type::size_type size_type;
-  typedef data_type::const_iterator const_iterator;
-  typedef data_type::const_reference const_reference;
+  typedef boost::indirect_iterator<data_type::const_iterator, const PolyEntry>
+  const_iterator;
+  typedef const value_type& const_reference;
   typedef PolyEntryReference reference;
 
-  bool empty() const { return m_data.empty(); }
-  size_type size() const { return m_data.size(); }
-  const_iterator begin() const { return m_data.begin(); }
-  const_iterator end() const { return m_data.end(); }
-  const_reference front() const { return m_data.front(); }
-  const_reference back() const { return m_data.back(); }
+  bool empty() const { return m_data->empty(); }
+  size_type size() const { return m_data->size(); }
+  const_iterator begin() const { return m_data->begin(); }
+  const_iterator end() const { return m_data->end(); }
+  const_reference front() const { return *m_data->front(); }
+  const_reference back() const { return *m_data->back(); }
 
   /// Read-only access to element by index, leading term or monomial
   template <class KeyType>
@@ -52,13 +64,13 @@ public:
   //@}
 
   /// Alternative to @c front which allows partial (but consistent) access
-  reference first() { return reference(m_data.front(), m_indices); }
+  reference first() { return entry(0); }
 
   /// Constant variant, equivalent to @c front, for completeness reasons
   const_reference first() const { return front(); }
 
   /// Alternative to @c back() which allows partial (but consistent) access
-  reference last() { return reference(m_data.back(), m_indices); }
+  reference last() { return entry(size() - 1); }
 
   /// Constant variant, equivalent to @c back, for completeness reasons
   const_reference last() const { return back(); }
@@ -69,25 +81,25 @@ public:
 
   /// Just insert element
   virtual void append(const PolyEntry& element) {
-    m_data.push_back(element);
+    m_data.mutate().push_back(entry_type(element));
 
 #ifndef PBORI_NDEBUG    
-    if(m_indices.checked(back().lead) != (size_type)-1)
+    if(m_indices->checked(back().lead) != (size_type)-1)
       throw std::runtime_error("leading terms not unique when appending to PolyEntryVector");
 #endif
-    m_indices.insert(back(), size() - 1);
+    m_indices.mutate().insert(back(), size() - 1);
   }
 
   /// Read-only access to element by index, leading term or monomial
   template <class KeyType>
   const_reference operator()(const KeyType& key) const {
-    return m_data[index(key)];
+    return *m_data.get()[index(key)];
   }
 
   /// (Partially) write access to element by index, leading term or monomial
   template <class KeyType>
   reference operator()(const KeyType& rhs) {
-    return reference(m_data[index(rhs)], m_indices);
+    return entry(index(rhs));
   }
 
   /// Exchange element given by @c key
@@ -96,13 +108,16 @@ public:
 
   /// Retrieve index associated to @c key
   template <class KeyType>
-  size_type index(const KeyType& key) const { return m_indices(key); }
+  size_type index(const KeyType& key) const { return (*m_indices)(key); }
 
   /// Retrieve index associated to @c key if @c key exists, -1 otherwise
   template <class KeyType>
   size_type checked_index(const KeyType& key) const {
-    return m_indices.checked(key);
+    return m_indices->checked(key);
   }
+  /// Indices, precomputed weights and revision of the elements
+  const PolyEntryIndices& indices() const { return *m_indices; }
+
   /// Retrieve polynomial associated to @c key
   template <class KeyType>
   const Polynomial& polynomial(const KeyType& key) const {
@@ -110,8 +125,13 @@ public:
   }
 
 private:
-  data_type m_data;
-  PolyEntryIndices m_indices;
+  /// Write access to the element at position @c idx (detaches it if shared)
+  reference entry(size_type idx) {
+    return reference(m_data.mutate()[idx].mutate(), m_indices);
+  }
+
+  CopyOnWrite<data_type> m_data;
+  CopyOnWrite<PolyEntryIndices> m_indices;
 };
 
 END_NAMESPACE_PBORIGB
@@ -0,0 +1,82 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file ReducerSelectionCache.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c ReducerSelectionCache.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_ReducerSelectionCache_h_
+#define polybori_groebner_ReducerSelectionCache_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+#include "PolyEntryIndices.h"
+
+#include <unordered_map>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class ReducerSelectionCache
+ * @brief This class stores the reductor selected for a leading monomial.
+ *
+ * The entries are valid for one revision of the @c PolyEntryIndices only,
+ * i. e. until generators are added or exchanged. Monomials are hashed by
+ * their (canonical) diagram node and kept alive by the cache.
+ *
+ * @note Copies start empty, since the copied strategy may change
+ * independently.
+ **/
+class ReducerSelectionCache {
+  typedef ReducerSelectionCache self;
+
+public:
+  typedef PolyEntryIndices::revision_type revision_type;
+
+  /// Marker for uncached monomials (-1 means that there is no reductor)
+  enum { not_cached = -2, max_size = 1 << 16 };
+
+  ReducerSelectionCache(): m_table(), m_revision(0) {}
+  ReducerSelectionCache(const self&): m_table(), m_revision(0) {}
+
+  self& operator=(const self&) {
+    m_table.clear();
+    return *this;
+  }
+
+  /// Lookup selection for lead, valid for the given revision
+  int find(const Monomial& lead, revision_type revision) {
+    if PBORI_UNLIKELY(revision != m_revision) {
+      m_table.clear();
+      m_revision = revision;
+      return not_cached;
+    }
+    table_type::const_iterator found = m_table.find(lead);
+    return (found == m_table.end()? int(not_cached): found->second);
+  }
+
+  /// Store selection (for the revision of the previous lookup)
+  int insert(const Monomial& lead, int selected) {
+    if PBORI_UNLIKELY(m_table.size() >= max_size)
+      m_table.clear();
+    m_table.insert(std::make_pair(lead, selected));
+    return selected;
+  }
+
+private:
+  typedef std::unordered_map<Monomial, int, hashes<Monomial> > table_type;
+
+  table_type m_table;
+  revision_type m_revision;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_ReducerSelectionCache_h_ */
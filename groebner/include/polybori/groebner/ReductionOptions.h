@@ -30,13 +30,18 @@ class ReductionOptions {
 public:
   ReductionOptions():
     optBrutalReductions(true), optLL(false), 
-    optRedTailDegGrowth(true), optRedTail(true), 
-    reducibleUntil(-1) {}
+    optRedTailDegGrowth(true), optRedTail(true), optLLTable(false),
+    llForkDepth(0), reducibleUntil(-1) {}
 
   bool optBrutalReductions;
   bool optLL;
   bool optRedTailDegGrowth;
   bool optRedTail;
+  /// Reduce by the precompiled substitution table of @c llReductor
+  bool optLLTable;
+  /// Reduce large polynomials by @c llReductor in parallel below this number
+  /// of top-most levels (0: serially, see @c ll_red_nf_forked)
+  unsigned llForkDepth;
   idx_type reducibleUntil;
 };
 
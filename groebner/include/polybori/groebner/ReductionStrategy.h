@@ -22,6 +22,7 @@
 #include "PolyEntryVector.h"
 #include "ReductionOptions.h"
 #include "ReductionTerms.h"
+#include "ReducerSelectionCache.h"
 #include "SetAssociatedMinimal.h"
 
 BEGIN_NAMESPACE_PBORIGB
@@ -38,7 +39,7 @@ public:
 
     ReductionStrategy(const BoolePolyRing& ring):
       PolyEntryVector(), ReductionOptions(),
-      ReductionTerms(ring)  { }
+      ReductionTerms(ring), m_select1(), m_select_short()  { }
 
     /// Adding next element
     void addGenerator(const PolyEntry& entry) {
@@ -54,6 +55,14 @@ public:
       return (optRedTail? reducedNormalForm(p): headNormalForm(p));
     }
 
+    /// Reduce by the linear-lead reductors in @c llReductor
+    Polynomial llNormalForm(const Polynomial& p) const {
+      if (optLLTable)
+        return llReductor.substitute(p);
+      return (llForkDepth > 0? ll_red_nf_forked(p, llReductor, llForkDepth):
+              ll_red_nf(p, llReductor));
+    }
+
     bool canRewrite(const Polynomial& p) const {
       return is_rewriteable(p, minimalLeadingTerms);
     }
@@ -62,11 +71,9 @@ public:
     int select1(const Monomial& m) const;
 
     int select_short(const Polynomial& p) const {
-      return select_short_by_terms(p.leadDivisors());
-    }
-    int select_short(const Monomial& m) const {
-      return select_short_by_terms(m.divisors());
+      return select_short(p.lead());
     }
+    int select_short(const Monomial& m) const;
 
     Polynomial headNormalForm(const Polynomial& p) const;
     Polynomial reducedNormalForm(const Polynomial& p) const;
@@ -87,23 +94,36 @@ protected:
   void setupSetsForElement(const PolyEntry& entry);
 
 
-  template <class Iterator, class CompareType>
-  size_type minimum(Iterator start, Iterator finish, const CompareType& comp)
-    const {
-    start = std::min_element(start, finish, comp);
-    if PBORI_UNLIKELY(start == finish)
-      return size_type(-1);
-    
-    return index(*start);
+  /// Index of the first element with minimal weight among the given leads
+  /// (weights are precomputed, so no @c PolyEntry is accessed)
+  int minimum(const MonomialSet& leads,
+              wlen_type (PolyEntryIndices::*weight)(PolyEntryIndices::data_type)
+              const) const {
+    const PolyEntryIndices& table = indices();
+    int result = -1;
+    wlen_type least = 0;
+    for (MonomialSet::exp_iterator start(leads.expBegin()),
+           finish(leads.expEnd()); start != finish; ++start) {
+      int idx = table(*start);
+      wlen_type value = (table.*weight)(idx);
+      if ((result == -1) || (value < least)) {
+        result = idx;
+        least = value;
+      }
+    }
+    return result;
   }
 
+private:
+  /// Selected reductors by leading monomial
+  mutable ReducerSelectionCache m_select1, m_select_short;
 };
 
 
 inline bool
 irreducible_lead(Monomial lm, const ReductionStrategy& strat){
 
-  return (!(strat.minimalLeadingTerms.hasTermOfVariables(lm)));//
+  return (!(strat.minimalLeadingTerms.containsDivisorOf(lm)));//
   //        strat.generators.minimalLeadingTerms.intersect(lm.divisors()).isZero();
 }
 
@@ -25,6 +25,7 @@
 #include "LeadingTerms00.h"
 #include "LeadingTerms11.h"
 #include "MonomialPlusOneTerms.h"
+#include "BinomialReductors.h"
 
 #include <polybori/routines/pbori_algo.h> // which
 
@@ -55,12 +56,14 @@ public:
   LLReductor llReductor;
   MonomialTerms monomials;
   MonomialPlusOneTerms monomials_plus_one;
+  BinomialReductors binomials;
   
   /// Initialize term data for given ring
   ReductionTerms(const BoolePolyRing& ring):
     leadingTerms(ring), minimalLeadingTerms(ring),
     leadingTerms11(ring), leadingTerms00(ring),
-    llReductor(ring), monomials(ring), monomials_plus_one(ring)  { }
+    llReductor(ring), monomials(ring), monomials_plus_one(ring),
+    binomials(ring)  { }
 
   /// Compute terms owning variables of current entry's leading term
   /// @note Side effect: adds additional data to @c treat_pairs
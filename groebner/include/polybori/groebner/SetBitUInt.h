@@ -28,7 +28,7 @@ BEGIN_NAMESPACE_PBORIGB
 class SetBitUInt{
     public:
         void operator() (unsigned int& vec, int index){
-            vec|=(1<<index);
+            vec|=(1u<<index);
         }
 };
 
@@ -0,0 +1,204 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file SignatureStrategy.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c SignatureStrategy.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_SignatureStrategy_h_
+#define polybori_groebner_SignatureStrategy_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+#include "LeadIndexTable.h"
+#include "ReductionStrategy.h"
+
+#include <memory>
+#include <vector>
+#include <queue>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class SignatureTermOrder
+ * @brief Extends the ordering of a ring to terms of the polynomial ring.
+ *
+ * Signatures live in the polynomial ring over GF(2), i.e. their exponents
+ * might exceed one. Terms are given as sorted index sequences (with
+ * repetitions). On square-free terms the result coincides with the ordering
+ * of the ring.
+ **/
+class SignatureTermOrder {
+public:
+  typedef std::vector<idx_type> term_type;
+  typedef term_type::const_iterator const_iterator;
+  typedef CTypes::comp_type comp_type;
+
+  SignatureTermOrder(const BoolePolyRing& ring);
+
+  /// Three-way comparison of terms
+  comp_type compare(const term_type& lhs, const term_type& rhs) const {
+    return compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  /// Three-way comparison of (square-free) exponents
+  comp_type compare(const Exponent& lhs, const Exponent& rhs) const {
+    return compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+private:
+  comp_type compare(const_iterator lhs_start, const_iterator lhs_finish,
+                    const_iterator rhs_start, const_iterator rhs_finish) const;
+
+  std::vector<idx_type> m_blocks;
+  bool m_degree;
+  bool m_ascending;
+};
+
+/** @class SignatureStrategy
+ * @brief Signature-based (GVW-style) computation of Boolean Groebner bases.
+ *
+ * Generators are added incrementally. For the i-th generator the module
+ * signatures are terms times e_i (position over term), while the basis of the
+ * previous generators is replaced by its reduced Groebner basis. Reductions by
+ * the latter do not change signatures, so they are the usual normal forms of
+ * a @c ReductionStrategy. The field equations are treated as generators of
+ * lowest position, hence each signature
+ * containing a square is a (Koszul) syzygy, and reduction modulo the field
+ * equations is the Boolean arithmetic itself.
+ *
+ * Pairs whose signature is divisible by a known syzygy signature, and pairs
+ * which can be rewritten by an element of smaller leading term, are
+ * discarded without reduction. Their number is kept in @c syzygyCriterions
+ * and @c rewriteCriterions.
+ **/
+class SignatureStrategy {
+  typedef SignatureStrategy self;
+
+public:
+  typedef SignatureTermOrder::term_type term_type;
+  typedef std::vector<Polynomial>::size_type size_type;
+
+  /// Construct from a ring
+  SignatureStrategy(const BoolePolyRing& ring);
+
+  const BoolePolyRing& ring() const { return m_ring; }
+
+  /// Add next generator and complete the basis for it
+  void addGenerator(const Polynomial& poly);
+
+  /// Check, whether the ideal is the whole ring
+  bool containsOne() const { return m_containsOne; }
+
+  /// Number of elements of the signature basis
+  size_type size() const { return m_elements.size(); }
+
+  std::vector<Polynomial> allGenerators() const;
+  std::vector<Polynomial> minimalize() const;
+  std::vector<Polynomial> minimalizeAndTailReduce() const;
+
+  /// Number of pairs discarded without any reduction
+  unsigned long avoidedZeroReductions() const {
+    return syzygyCriterions + rewriteCriterions;
+  }
+
+  void log(const char* c) const { if (enabledLog) std::cout<<c<<std::endl; }
+
+  /// @name public available parameters
+  bool enabledLog;
+
+  unsigned long reductionSteps;
+  unsigned long zeroReductions;
+  unsigned long syzygyCriterions;
+  unsigned long rewriteCriterions;
+
+protected:
+  /// Labeled polynomial of the basis
+  struct element_type {
+    element_type(const Polynomial& poly, const Exponent& signature,
+                 size_type pos):
+      p(poly), leadExp(poly.leadExp()), sig(signature), level(pos),
+      length(poly.length()) {}
+
+    Polynomial p;
+    Exponent leadExp;
+    Exponent sig;
+    size_type level;
+    len_type length;
+  };
+
+  /// Multiple of an element (or the current generator) to be reduced
+  struct pair_type {
+    pair_type(const Exponent& signature, const Exponent& factor,
+              size_type idx, const term_type& term):
+      sig(signature), multiplier(factor), element(idx), lead(term) {}
+
+    Exponent sig;
+    Exponent multiplier;
+    size_type element;
+    term_type lead;
+  };
+
+  /// Priority ordering: smallest signature first, then smallest lead
+  class pair_greater {
+  public:
+    pair_greater(const SignatureTermOrder& order): m_order(order) {}
+
+    bool operator()(const pair_type& lhs, const pair_type& rhs) const;
+
+  private:
+    SignatureTermOrder m_order;
+  };
+
+  typedef std::priority_queue<pair_type, std::vector<pair_type>,
+                              pair_greater> queue_type;
+
+  bool isSyzygy(const Exponent& sig) const;
+  bool isRewritable(const pair_type& pair) const;
+  Polynomial regularReduce(Polynomial poly, const Exponent& sig,
+                           bool& singular);
+
+  void addElement(const Polynomial& poly, const Exponent& sig);
+  void registerElement(size_type idx);
+  void addPair(const Exponent& sig, const Exponent& factor, size_type idx,
+               const term_type& lead);
+  void addSyzygy(const Exponent& sig);
+
+  const element_type& minimalElement(const Exponent& lead) const;
+
+private:
+  static const size_type npos = size_type(-1);
+
+  BoolePolyRing m_ring;
+  SignatureTermOrder m_order;
+
+  std::vector<element_type> m_elements;
+  /// Leading terms and elements owning them
+  MonomialSet m_leads;
+  LeadIndexTable<Exponent, LeadExpHasher> m_lead2owners;
+  std::vector<std::vector<size_type> > m_owners;
+
+  /// Reduced basis of the previous levels (generator positions)
+  std::shared_ptr<ReductionStrategy> m_reductors;
+
+  /// Data of the current level (generator position)
+  size_type m_level;
+  Polynomial m_input;
+  MonomialSet m_syzygies;
+  MonomialSet m_signatures;
+  LeadIndexTable<Exponent, LeadExpHasher> m_sig2element;
+  queue_type m_pairs;
+
+  bool m_containsOne;
+};
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_SignatureStrategy_h_ */
@@ -0,0 +1,133 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file SparseRowMatrix.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c SparseRowMatrix.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_groebner_SparseRowMatrix_h_
+#define polybori_groebner_SparseRowMatrix_h_
+
+// include basic definitions
+#include "groebner_defs.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+BEGIN_NAMESPACE_PBORIGB
+
+/** @class SparseRowMatrix
+ * @brief This class defines a matrix over GF(2), whose rows are stored as
+ * sorted vectors of the column indices of their nonzero entries.
+ *
+ * Hence, memory and the costs of multiplying a (sparse) row vector from the
+ * left are bounded by the number of nonzero entries involved, instead of the
+ * square of the dimension for dense matrices like @c mzd_t.
+ **/
+class SparseRowMatrix {
+  typedef SparseRowMatrix self;
+
+public:
+  typedef unsigned int index_type;
+  typedef std::vector<index_type> row_type;
+  typedef std::vector<row_type>::size_type size_type;
+
+  SparseRowMatrix(size_type nrows = 0): m_rows(nrows) {}
+
+  row_type& operator[](size_type idx) { return m_rows[idx]; }
+  const row_type& operator[](size_type idx) const { return m_rows[idx]; }
+
+  /// Number of rows
+  size_type nrows() const { return m_rows.size(); }
+
+  /// Number of nonzero entries
+  size_type nnz() const {
+    size_type result = 0;
+    for (std::vector<row_type>::const_iterator start(m_rows.begin());
+         start != m_rows.end(); ++start)
+      result += start->size();
+    return result;
+  }
+
+  class Accumulator;
+
+  /// Product of row vector vec with this matrix, i. e. the sum of the rows
+  /// selected by vec
+  void multiply(const row_type& vec, row_type& result,
+                Accumulator& acc) const;
+
+  /// Sum of the (sorted) range [start, finish) and row
+  static void add(row_type::const_iterator start,
+                  row_type::const_iterator finish, const row_type& row,
+                  row_type& result) {
+    result.clear();
+    std::set_symmetric_difference(start, finish, row.begin(), row.end(),
+                                  std::back_inserter(result));
+  }
+
+private:
+  std::vector<row_type> m_rows;
+};
+
+/** @class SparseRowMatrix::Accumulator
+ * @brief This class sums up sparse rows in a dense array of parities, such
+ * that only the touched entries have to be collected and reset afterwards.
+ **/
+class SparseRowMatrix::Accumulator {
+public:
+  Accumulator(size_type ncols = 0): m_state(ncols, 0), m_touched() {}
+
+  /// Add a single entry
+  void toggle(index_type idx) {
+    if (m_state[idx] == 0)
+      m_touched.push_back(idx);
+    m_state[idx] = (m_state[idx] == 1? 2: 1);
+  }
+
+  /// Add row
+  void add(const row_type& row) {
+    for (row_type::const_iterator start(row.begin()); start != row.end();
+         ++start)
+      toggle(*start);
+  }
+
+  /// Write (sorted) sum to result and reset
+  void extract(row_type& result) {
+    result.clear();
+    for (row_type::const_iterator start(m_touched.begin());
+         start != m_touched.end(); ++start) {
+      if (m_state[*start] == 1)
+        result.push_back(*start);
+      m_state[*start] = 0;
+    }
+    m_touched.clear();
+    std::sort(result.begin(), result.end());
+  }
+
+private:
+  /// 0 for untouched entries, 1 and 2 for odd and even numbers of touches
+  std::vector<unsigned char> m_state;
+  row_type m_touched;
+};
+
+inline void
+SparseRowMatrix::multiply(const row_type& vec, row_type& result,
+                          Accumulator& acc) const {
+  for (row_type::const_iterator start(vec.begin()); start != vec.end();
+       ++start)
+    acc.add(m_rows[*start]);
+  acc.extract(result);
+}
+
+END_NAMESPACE_PBORIGB
+
+#endif /* polybori_groebner_SparseRowMatrix_h_ */
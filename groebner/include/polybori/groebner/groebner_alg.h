@@ -55,6 +55,7 @@ Polynomial mult_fast_sim(const std::vector<Polynomial>& vec,
 			 const BoolePolyRing& ring);
 std::vector<Polynomial> full_implication_gb(const Polynomial & p,CacheManager& cache,GroebnerStrategy& strat);
 Polynomial reduce_complete(const Polynomial &p, const PolyEntry& reductor, wlen_type &len);
+MonomialSet reduce_complete_factor(const Polynomial &p, const PolyEntry& reductor, wlen_type &len);
 MonomialSet recursively_insert(MonomialSet::navigator p, idx_type idx, MonomialSet mset);
 
 
@@ -3,6 +3,7 @@
 #include "groebner_defs.h"
 BEGIN_NAMESPACE_PBORIGB
 MonomialSet variety_lex_leading_terms(const MonomialSet& points, const Monomial& variables);
+MonomialSet variety_lex_standard_monomials(const MonomialSet& points);
 Polynomial interpolate(MonomialSet to_zero,MonomialSet to_one);
 Polynomial interpolate_smallest_lex(MonomialSet to_zero,MonomialSet to_one);
 MonomialSet zeros(Polynomial p, MonomialSet candidates);
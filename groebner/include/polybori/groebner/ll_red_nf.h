@@ -50,6 +50,20 @@ ll_red_nf_generic(const Polynomial& p, MonomialSet::navigator r_nav){
   return func(p, r_nav);
 }
 
+/// Variant of @c ll_red_nf_generic, which reduces the independent branches
+/// below the top-most @c depth levels in parallel (for large inputs only)
+template <bool have_redsb, bool single_call_for_noredsb, 
+	  bool fast_multiplication>
+inline Polynomial
+ll_red_nf_generic(const Polynomial& p, MonomialSet::navigator r_nav,
+                  unsigned depth, CDDForkJoin::size_type cutoff =
+                  CDDForkJoin::default_cutoff){
+  LLReduction<have_redsb, single_call_for_noredsb, fast_multiplication> 
+    func(p.ring());
+  
+  return func(p, r_nav, depth, cutoff);
+}
+
 template <bool have_redsb, bool single_call_for_noredsb,
 	  bool fast_multiplication>
 inline Polynomial
@@ -64,6 +78,14 @@ ll_red_nf(const Polynomial& p,const BooleSet& reductors){
   return ll_red_nf_generic<true, false, false>(p,reductors);
 }
 
+/// Parallel variant of @c ll_red_nf, see @c CDDForkJoin
+inline Polynomial
+ll_red_nf_forked(const Polynomial& p, const BooleSet& reductors,
+                 unsigned depth = 2){
+  return ll_red_nf_generic<true, false, false>(p, reductors.navigation(),
+                                               depth);
+}
+
 inline Polynomial
 ll_red_nf_noredsb(const Polynomial& p,const BooleSet& reductors){
   return ll_red_nf_generic<false, false, false>(p,reductors);
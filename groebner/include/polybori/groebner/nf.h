@@ -42,6 +42,7 @@ Polynomial plug_1(const Polynomial& p, const MonomialSet& m_plus_ones);
 MonomialSet mod_mon_set(const MonomialSet& as, const MonomialSet &vs);
 
 Polynomial cheap_reductions(const ReductionStrategy& strat, Polynomial p);
+Polynomial binomial_nf(const ReductionStrategy& strat, Polynomial p);
 
 Polynomial nf3_lexbuckets(const GroebnerStrategy& strat, Polynomial p, Monomial rest_lead);
 Polynomial nf3_no_deg_growth(const ReductionStrategy& strat, Polynomial p, Monomial rest_lead);
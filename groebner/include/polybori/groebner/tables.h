@@ -21,6 +21,7 @@
 #include <stdexcept>
 #include <polybori/groebner/ZeroFunction.h>
 #include <polybori/groebner/SetBitUInt.h>
+#include <polybori/groebner/GroebnerTableGenerator.h>
 
 // Data ordering tables
 #include <polybori/groebner/dlex4data.h>
@@ -66,6 +67,11 @@ p2code_4(Polynomial p, const std::vector<char> & ring_2_0123){
   return p2code<unsigned int, ZeroFunction, SetBitUInt>(p,ring_2_0123, 4);
 }
 
+inline unsigned int
+p2code_5(Polynomial p, const std::vector<char> & ring_2_0123){
+  return p2code<unsigned int, ZeroFunction, SetBitUInt>(p,ring_2_0123, 5);
+}
+
 inline unsigned int
 get_table_entry4(const BoolePolyRing& ring, int p_code, int pos){
   switch(ring.ordering().getBaseOrderCode()){
@@ -109,6 +115,32 @@ code_2_poly_4(const BoolePolyRing& ring,
   return result;
 }
 
+inline Monomial
+code_2_m(const BoolePolyRing& ring, 
+         unsigned int code, const std::vector<idx_type>& back_2_ring){
+
+    Monomial result(ring);
+    for(int idx = back_2_ring.size() - 1; idx >= 0; --idx){
+      if ((code & (1u<<idx)) != 0){
+        result *= ring.variable(back_2_ring[idx]);
+      }
+    }
+    return result;
+}
+
+inline Polynomial
+code_2_poly(const BoolePolyRing& ring,
+            unsigned int code, const std::vector<idx_type>& back_2_ring){
+
+  Polynomial result(ring);
+  for(int idx = 31; idx >= 0; --idx){
+    if ((code & (1u<<idx)) != 0){
+      result += code_2_m(ring, idx, back_2_ring);
+    }
+  }
+  return result;
+}
+
 inline bool 
 have_ordering_for_tables(const int order_code) {
         if (order_code==COrderEnums::dlex)
@@ -130,6 +162,31 @@ have_base_ordering_for_tables(const BoolePolyRing& ring){
   return have_ordering_for_tables(ring.ordering().getBaseOrderCode());
 }
 
+/// Codes of the reduced Groebner basis of the polynomial with code p_code in
+/// (up to five) used variables, from the precomputed tables if applicable
+/// (and from the given generators otherwise)
+inline void
+get_table_entries(GroebnerTableGenerators& generators,
+                  const BoolePolyRing& ring, const Exponent& used_variables,
+                  unsigned int p_code, std::vector<unsigned int>& entries){
+
+  entries.clear();
+  if ((used_variables.size() <= 4) &&
+      (have_ordering_for_tables(ring) ||
+       (have_base_ordering_for_tables(ring) && ((used_variables.size() < 2) ||
+        ring.ordering().lieInSameBlock(*used_variables.begin(),
+                                       *(used_variables.end() - 1)))))){
+    for(int i = 0; get_table_entry4(ring, p_code, i) != 0; i++)
+      entries.push_back(get_table_entry4(ring, p_code, i));
+  }
+  else {
+    const unsigned int* codes =
+      generators(ring, used_variables)[p_code];
+    while (*codes != 0)
+      entries.push_back(*codes++);
+  }
+}
+
 
 END_NAMESPACE_PBORIGB
 
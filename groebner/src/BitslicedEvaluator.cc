@@ -0,0 +1,334 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file BitslicedEvaluator.cc
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c BitslicedEvaluator.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+// include definitions
+#include <polybori/groebner/BitslicedEvaluator.h>
+#include <polybori/groebner/add_up.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <ostream>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+BEGIN_NAMESPACE_PBORIGB
+
+typedef std::unordered_map<MonomialSet::navigator::pointer_type, unsigned>
+bitsliced_node_map;
+
+// Append instructions for the node nav (and its unvisited descendants), which
+// write to single-assignment values, and return the value of nav
+static unsigned
+compile_node(MonomialSet::navigator nav, const std::vector<unsigned>& input_of,
+             bitsliced_node_map& values,
+             std::vector<BitslicedEvaluator::instruction_type>& program,
+             unsigned& next_value) {
+
+  if (nav.isConstant())
+    return (nav.terminalValue()? BitslicedEvaluator::one_reg:
+            BitslicedEvaluator::zero_reg);
+
+  bitsliced_node_map::const_iterator found = values.find(nav.getNode());
+  if (found != values.end())
+    return found->second;
+
+  unsigned then_value = compile_node(nav.thenBranch(), input_of, values,
+                                     program, next_value);
+  unsigned else_value = compile_node(nav.elseBranch(), input_of, values,
+                                     program, next_value);
+  BitslicedEvaluator::instruction_type instr =
+    { next_value++, input_of[*nav], then_value, else_value };
+  program.push_back(instr);
+  values[nav.getNode()] = instr.dst;
+  return instr.dst;
+}
+
+// Write the bits [0, nbits) of words (inverted, if requested) to result
+static void
+store_lane_bits(const BitslicedEvaluator::word_type* words,
+                BitslicedEvaluator::size_type nbits, bool invert,
+                BitslicedEvaluator::word_type* result) {
+
+  typedef BitslicedEvaluator::word_type word_type;
+  const unsigned word_bits = BitslicedEvaluator::word_bits;
+  for (BitslicedEvaluator::size_type k = 0; k * word_bits < nbits; ++k) {
+    word_type bits = (invert? ~words[k]: words[k]);
+    if ((k + 1) * word_bits > nbits)
+      bits &= (word_type(1) << (nbits - k * word_bits)) - 1;
+    result[k] = bits;
+  }
+}
+
+BitslicedEvaluator::BitslicedEvaluator(const Polynomial& poly):
+  m_ring(poly.ring()), m_program(), m_input_of(), m_ninputs(0),
+  m_nregisters(0), m_results() {
+
+  compile(std::vector<Polynomial>(1, poly));
+}
+
+BitslicedEvaluator::BitslicedEvaluator(const std::vector<Polynomial>& polys):
+  m_ring(polys.at(0).ring()), m_program(), m_input_of(), m_ninputs(0),
+  m_nregisters(0), m_results() {
+
+  compile(polys);
+}
+
+void
+BitslicedEvaluator::compile(const std::vector<Polynomial>& polys) {
+
+  m_input_of.assign(m_ring.nVariables(), zero_reg);
+  Monomial used(m_ring);
+  for (std::vector<Polynomial>::const_iterator start(polys.begin());
+       start != polys.end(); ++start)
+    used *= start->usedVariables();
+  for (Monomial::const_iterator start(used.begin()); start != used.end();
+       ++start)
+    m_input_of[*start] = input_reg + m_ninputs++;
+
+  // node values are shared between the polynomials
+  unsigned next_value = input_reg + m_ninputs;
+  bitsliced_node_map values;
+  std::vector<unsigned> results;
+  results.reserve(polys.size());
+  for (std::vector<Polynomial>::const_iterator start(polys.begin());
+       start != polys.end(); ++start)
+    results.push_back(compile_node(start->navigation(), m_input_of, values,
+                                   m_program, next_value));
+
+  // allocate registers, such that values share them after their last use
+  std::vector<size_type> last_use(next_value, 0);
+  for (size_type idx = 0; idx < m_program.size(); ++idx) {
+    last_use[m_program[idx].then_reg] = idx;
+    last_use[m_program[idx].else_reg] = idx;
+  }
+  for (size_type idx = 0; idx < results.size(); ++idx)
+    last_use[results[idx]] = m_program.size();
+
+  std::vector<unsigned> reg_of(next_value);
+  for (unsigned value = 0; value < input_reg + m_ninputs; ++value)
+    reg_of[value] = value;
+  std::vector<unsigned> free_regs;
+  unsigned nregs = input_reg + m_ninputs;
+
+  for (size_type idx = 0; idx < m_program.size(); ++idx) {
+    instruction_type& instr = m_program[idx];
+    unsigned operands[2] = { instr.then_reg, instr.else_reg };
+    instr.then_reg = reg_of[operands[0]];
+    instr.else_reg = reg_of[operands[1]];
+    for (unsigned op = 0; op < 2; ++op)
+      if ((operands[op] >= input_reg + m_ninputs) &&
+          (last_use[operands[op]] == idx) &&
+          ((op == 0) || (operands[1] != operands[0])))
+        free_regs.push_back(reg_of[operands[op]]);
+
+    unsigned value = instr.dst;
+    if (free_regs.empty())
+      instr.dst = nregs++;
+    else {
+      instr.dst = free_regs.back();
+      free_regs.pop_back();
+    }
+    reg_of[value] = instr.dst;
+  }
+
+  m_results.clear();
+  for (size_type idx = 0; idx < results.size(); ++idx)
+    m_results.push_back(reg_of[results[idx]]);
+  m_nregisters = nregs;
+}
+
+void
+BitslicedEvaluator::run(lane_type* regs) const {
+
+  for (std::vector<instruction_type>::const_iterator
+         start(m_program.begin()); start != m_program.end(); ++start) {
+    const lane_type& var = regs[start->var];
+    const lane_type& then_lane = regs[start->then_reg];
+    const lane_type& else_lane = regs[start->else_reg];
+
+    word_type words[lane_words];
+    for (unsigned k = 0; k < lane_words; ++k)
+      words[k] = (var.words[k] & then_lane.words[k]) ^ else_lane.words[k];
+    std::copy(words, words + lane_words, regs[start->dst].words);
+  }
+}
+
+void
+BitslicedEvaluator::evaluateLane(const std::vector<Exponent>& points,
+                                 size_type start, lane_type* regs) const {
+
+  size_type finish = std::min<size_type>(start + lane_bits, points.size());
+  for (size_type reg = input_reg; reg < input_reg + m_ninputs; ++reg)
+    std::fill(regs[reg].words, regs[reg].words + lane_words, 0);
+
+  for (size_type idx = start; idx < finish; ++idx) {
+    const size_type bit = idx - start;
+    for (Exponent::const_iterator var(points[idx].begin());
+         var != points[idx].end(); ++var)
+      regs[m_input_of[*var]].words[bit / word_bits] |=
+        word_type(1) << (bit % word_bits);
+  }
+  // unused variables went to the zero register
+  std::fill(regs[zero_reg].words, regs[zero_reg].words + lane_words, 0);
+
+  run(regs);
+}
+
+template <class Operation>
+void
+BitslicedEvaluator::forEachLane(size_type npoints, unsigned nthreads,
+                                const Operation& op) const {
+
+  const size_type nlanes = (npoints + lane_bits - 1) / lane_bits;
+  if (nlanes == 0)
+    return;
+
+  size_type nworkers = (nthreads > 0? nthreads:
+    std::min<size_type>(std::max(1u, std::thread::hardware_concurrency()),
+                        nlanes / parallel_cutoff + 1));
+  nworkers = std::min(nworkers, nlanes);
+
+  std::atomic<size_type> next(0);
+  std::vector<std::exception_ptr> errors(nworkers);
+  auto work = [&](size_type thread_idx) {
+    try {
+      std::vector<lane_type> regs(m_nregisters);
+      std::fill(regs[one_reg].words, regs[one_reg].words + lane_words,
+                ~word_type(0));
+      for (size_type lane = next++; lane < nlanes; lane = next++)
+        op(lane, &regs[0]);
+    }
+    catch (...) {
+      errors[thread_idx] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_type idx = 1; idx < nworkers; ++idx)
+    threads.push_back(std::thread(work, idx));
+  work(0);
+  std::for_each(threads.begin(), threads.end(),
+                std::mem_fn(&std::thread::join));
+  for (size_type idx = 0; idx < nworkers; ++idx)
+    if PBORI_UNLIKELY(errors[idx])
+      std::rethrow_exception(errors[idx]);
+}
+
+BitslicedEvaluator::bitmap_type
+BitslicedEvaluator::zeroBitmap(const MonomialSet& candidates,
+                               unsigned nthreads) const {
+
+  std::vector<Exponent> points;
+  points.reserve(candidates.size());
+  std::copy(candidates.expBegin(), candidates.expEnd(),
+            std::back_inserter(points));
+
+  // lanes write to disjoint words of the result
+  bitmap_type result((points.size() + word_bits - 1) / word_bits, 0);
+  forEachLane(points.size(), nthreads, [&](size_type lane, lane_type* regs) {
+      evaluateLane(points, lane * lane_bits, regs);
+      word_type nonzeros[lane_words] = {};
+      for (size_type idx = 0; idx < m_results.size(); ++idx)
+        for (unsigned k = 0; k < lane_words; ++k)
+          nonzeros[k] |= regs[m_results[idx]].words[k];
+      store_lane_bits(nonzeros, std::min<size_type>(lane_bits,
+                        points.size() - lane * lane_bits), true,
+                      &result[lane * lane_words]);
+    });
+  return result;
+}
+
+MonomialSet
+BitslicedEvaluator::zeros(const MonomialSet& candidates,
+                          unsigned nthreads) const {
+
+  bitmap_type bitmap = zeroBitmap(candidates, nthreads);
+
+  std::vector<Exponent> result;
+  MonomialSet::exp_iterator point(candidates.expBegin());
+  for (size_type idx = 0; idx < bitmap.size(); ++idx) {
+    for (size_type bit = 0; (bit < word_bits) &&
+           (point != candidates.expEnd()); ++bit, ++point)
+      if (bitmap[idx] & (word_type(1) << bit))
+        result.push_back(*point);
+  }
+  return add_up_exponents(result, m_ring.zero()).diagram();
+}
+
+std::vector<BitslicedEvaluator::bitmap_type>
+BitslicedEvaluator::values(const std::vector<Exponent>& points,
+                           unsigned nthreads) const {
+
+  std::vector<bitmap_type> result(m_results.size(),
+    bitmap_type((points.size() + word_bits - 1) / word_bits, 0));
+  forEachLane(points.size(), nthreads, [&](size_type lane, lane_type* regs) {
+      evaluateLane(points, lane * lane_bits, regs);
+      for (size_type idx = 0; idx < m_results.size(); ++idx)
+        store_lane_bits(regs[m_results[idx]].words,
+                        std::min<size_type>(lane_bits,
+                          points.size() - lane * lane_bits), false,
+                        &result[idx][lane * lane_words]);
+    });
+  return result;
+}
+
+void
+BitslicedEvaluator::writeC(std::ostream& os, const std::string& name) const {
+
+  // names of the registers: constants, inputs x[i] and temporaries
+  std::vector<std::string> names(m_nregisters);
+  names[zero_reg] = "(uint64_t)0";
+  names[one_reg] = "~(uint64_t)0";
+  for (size_type idx = 0; idx < m_input_of.size(); ++idx)
+    if (m_input_of[idx] != zero_reg) {
+      std::ostringstream var;
+      var << "x[" << idx << "]";
+      names[m_input_of[idx]] = var.str();
+    }
+  for (size_type reg = input_reg + m_ninputs; reg < m_nregisters; ++reg) {
+    std::ostringstream temp;
+    temp << "t" << reg;
+    names[reg] = temp.str();
+  }
+
+  os << "#include <stdint.h>" << std::endl << std::endl
+     << "void " << name << "(const uint64_t* x, uint64_t* y) {" << std::endl;
+  if (m_nregisters > input_reg + m_ninputs) {
+    os << "  uint64_t";
+    for (size_type reg = input_reg + m_ninputs; reg < m_nregisters; ++reg)
+      os << (reg == input_reg + m_ninputs? " ": ", ") << names[reg];
+    os << ";" << std::endl;
+  }
+
+  for (std::vector<instruction_type>::const_iterator
+         start(m_program.begin()); start != m_program.end(); ++start) {
+    os << "  " << names[start->dst] << " = ";
+    if (start->then_reg == one_reg)
+      os << names[start->var];
+    else
+      os << "(" << names[start->var] << " & " << names[start->then_reg] << ")";
+    if (start->else_reg != zero_reg)
+      os << " ^ " << names[start->else_reg];
+    os << ";" << std::endl;
+  }
+  for (size_type idx = 0; idx < m_results.size(); ++idx)
+    os << "  y[" << idx << "] = " << names[m_results[idx]] << ";" << std::endl;
+  os << "}" << std::endl;
+}
+
+END_NAMESPACE_PBORIGB
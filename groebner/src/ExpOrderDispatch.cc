@@ -0,0 +1,159 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file ExpOrderDispatch.cc
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of @c lex_sorted_to_ring_order.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+// include definitions
+#include <polybori/groebner/ExpOrderDispatch.h>
+
+BEGIN_NAMESPACE_PBORIGB
+
+typedef std::vector<std::size_t> position_vector;
+
+// Part of exp, whose indices are in [first, last)
+static std::pair<Exponent::const_iterator, Exponent::const_iterator>
+block_part(const Exponent& exp, idx_type first, idx_type last) {
+  return std::make_pair(std::lower_bound(exp.begin(), exp.end(), first),
+                        std::lower_bound(exp.begin(), exp.end(), last));
+}
+
+// Order the positions in [start, finish) of exps w.r.t. the blocks
+// [block, ends.size()). They are sorted lexicographically (greater first),
+// hence terms with equal parts in the block are adjacent and these parts are
+// sorted lexicographically. Then, only parts of the same degree have to be
+// reordered: this is done by a stable counting sort, and parts of equal
+// degree are reversed for reverse index comparers (since parts of equal
+// degree are not prefixes of each other).
+static void
+order_blocks(const std::vector<Exponent>& exps,
+             const std::vector<idx_type>& ends, std::size_t block,
+             bool reversed, position_vector::iterator start,
+             position_vector::iterator finish, position_vector& buffer) {
+
+  const idx_type first = (block == 0? 0: ends[block - 1]);
+  const idx_type last = ends[block];
+
+  // groups of equal parts: start offset and degree
+  std::vector<std::pair<std::size_t, std::size_t> > groups;
+  std::size_t max_deg = 0;
+  for (position_vector::iterator pos(start); pos != finish; ++pos) {
+    std::pair<Exponent::const_iterator, Exponent::const_iterator> part =
+      block_part(exps[*pos], first, last);
+    if (!groups.empty()) {
+      std::pair<Exponent::const_iterator, Exponent::const_iterator> prev =
+        block_part(exps[*(pos - 1)], first, last);
+      if (((part.second - part.first) == (prev.second - prev.first)) &&
+          std::equal(part.first, part.second, prev.first))
+        continue;
+    }
+    std::size_t deg = part.second - part.first;
+    groups.push_back(std::make_pair(pos - start, deg));
+    max_deg = std::max(max_deg, deg);
+  }
+  const std::size_t ngroups = groups.size();
+  groups.push_back(std::make_pair(finish - start, 0));
+
+  if (ngroups > 1) {
+    // stable counting sort of the groups by descending degrees
+    std::vector<std::size_t> offsets(max_deg + 2, 0);
+    for (std::size_t idx = 0; idx < ngroups; ++idx)
+      ++offsets[max_deg - groups[idx].second + 1];
+    for (std::size_t deg = 1; deg < offsets.size(); ++deg)
+      offsets[deg] += offsets[deg - 1];
+    std::vector<std::size_t> sorted(ngroups);
+    for (std::size_t idx = 0; idx < ngroups; ++idx)
+      sorted[offsets[max_deg - groups[idx].second]++] = idx;
+
+    if (reversed) {
+      std::vector<std::size_t>::iterator run(sorted.begin());
+      while (run != sorted.end()) {
+        std::vector<std::size_t>::iterator run_end(run + 1);
+        while ((run_end != sorted.end()) &&
+               (groups[*run_end].second == groups[*run].second))
+          ++run_end;
+        std::reverse(run, run_end);
+        run = run_end;
+      }
+    }
+
+    buffer.clear();
+    std::vector<std::pair<std::size_t, std::size_t> > reordered;
+    reordered.reserve(ngroups + 1);
+    for (std::size_t idx = 0; idx < ngroups; ++idx) {
+      reordered.push_back(std::make_pair(buffer.size(), 0));
+      buffer.insert(buffer.end(), start + groups[sorted[idx]].first,
+                    start + groups[sorted[idx] + 1].first);
+    }
+    reordered.push_back(std::make_pair(buffer.size(), 0));
+    std::copy(buffer.begin(), buffer.end(), start);
+    groups.swap(reordered);
+  }
+
+  if (block + 1 < ends.size())
+    for (std::size_t idx = 0; idx < ngroups; ++idx)
+      if (groups[idx + 1].first - groups[idx].first > 1)
+        order_blocks(exps, ends, block + 1, reversed,
+                     start + groups[idx].first, start + groups[idx + 1].first,
+                     buffer);
+}
+
+std::vector<std::size_t>
+lex_sorted_to_ring_order(const std::vector<Exponent>& exps,
+                         const BoolePolyRing& ring) {
+
+  const std::size_t nexps = exps.size();
+  position_vector result(nexps);
+  for (std::size_t idx = 0; idx < nexps; ++idx)
+    result[idx] = idx;
+
+  const COrderingBase& order = ring.ordering();
+  bool reversed = false;
+  switch(order.getOrderCode()) {
+  case COrderEnums::lp:
+    PBORI_ASSERT(std::is_sorted(exps.begin(), exps.end(),
+                                ExpGreaterBy<LexExpCompare>()));
+    return result;
+  case COrderEnums::dlex:
+  case COrderEnums::block_dlex:
+    break;
+  case COrderEnums::dp_asc:
+  case COrderEnums::block_dp_asc:
+    reversed = true;
+    break;
+  default:
+    {
+      DispatchedExpCompare compare(ring);
+      std::stable_sort(result.begin(), result.end(),
+                       [&](std::size_t lhs, std::size_t rhs) {
+                         return compare(exps[lhs], exps[rhs]) ==
+                           CTypes::greater_than;
+                       });
+      return result;
+    }
+  }
+  if (nexps < 2)
+    return result;
+
+  // a single block for plain degree orderings
+  std::vector<idx_type> ends(order.blockBegin(), order.blockEnd());
+  if (ends.empty())
+    ends.push_back(CTypes::max_index());
+
+  position_vector buffer;
+  buffer.reserve(nexps);
+  order_blocks(exps, ends, 0, reversed, result.begin(), result.end(),
+               buffer);
+  return result;
+}
+
+END_NAMESPACE_PBORIGB
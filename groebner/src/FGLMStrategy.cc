@@ -6,99 +6,19 @@
 //  Copyright 2008 The PolyBoRi Team.
 // 
 #include <exception>
+#include <atomic>
+#include <thread>
+#include <functional>
 #include <polybori/groebner/FGLMStrategy.h>
 #include <polybori/groebner/nf.h>
 #include <polybori/groebner/add_up.h>
 #include <polybori/groebner/interpolate.h>
-#include <polybori/groebner/draw_matrix.h>
+#include <polybori/groebner/ExpGreater.h>
 
 using namespace std;
 BEGIN_NAMESPACE_PBORIGB
 
 
-#if 0
-static void mult_by_combining_rows(mzd_t* dest, mzd_t* A, packedmatrix* B, packedmatrix* acc1, packedmatrix* acc2, FGLMStrategy::IndexVector& row_is_monomial){
-
-    int i,j;
-    const int m=A->nrows;
-    const int n=A->ncols;
-    //const int nblocks=A->width;
-    mzd_t* res_row=acc1;
-    mzd_t* dest_row=acc2;
-    PBORI_ASSERT(acc1->ncols==B->ncols);
-    PBORI_ASSERT(acc2->ncols==B->ncols);
-    PBORI_ASSERT(dest->nrows==A->nrows);
-    PBORI_ASSERT(dest->ncols==B->ncols);
-    
-    for(i=0;i<m;i++){
-        mzd_row_clear_offset(acc1, 0,0);
-        mzd_row_clear_offset(acc2, 0,0);
-        mzd_row_clear_offset(dest,i,0);
-        
-        for(j=0;j<n;j+=RADIX){
-            if (mzd_read_block(A,i,j)!=0){
-                const int j_bak=j;
-                for(j=j_bak;(j<j_bak+RADIX) && (j<n);j++){
-                    if (mzd_read_bit(A,i,j)==1){
-                        int monomial_idx;
-                        if ((monomial_idx=row_is_monomial[j])>=0){
-                            mzd_write_bit(res_row, 0, monomial_idx, (1+ mzd_read_bit(res_row,0,monomial_idx))%2);
-                        } else {
-                            mzd_combine(dest_row,0,0,B,j,0,res_row,0,0);
-                            std::swap(res_row,dest_row);
-                        }
-                    }
-                }
-                j=j_bak;
-
-            }
-        }
-
-            //how to do that most efficiently?
-            //copy res_row to dest
-
-            //mzd_row_clear_offset(dest_row,0,0);
-            //mzd_combine(dest,i,0,res_row,0,0,dest_row,0,0);
-
-        mzd_copy_row(dest,i,res_row,0);
-    }
-        
-       
-//if 0
-    int i,j;
-       const int m=A->nrows;
-       const int n=A->ncols;
-       mzd_t* res_row=acc1;
-       mzd_t* dest_row=acc2;
-       PBORI_ASSERT(acc1->ncols==B->ncols);
-       PBORI_ASSERT(acc2->ncols==B->ncols);
-       PBORI_ASSERT(dest->nrows==A->nrows);
-       PBORI_ASSERT(dest->ncols==B->ncols);
-       for(i=0;i<m;i++){
-           mzd_row_clear_offset(acc1, 0,0);
-           mzd_row_clear_offset(acc2, 0,0);
-           mzd_row_clear_offset(dest,i,0);
-           for(j=0;j<n;j++){
-               if (mzd_read_bit(A,i,j)){
-                   mzd_combine(dest_row,0,0,B,j,0,res_row,0,0);
-                   std::swap(res_row,dest_row);
-               }
-           }
-           //how to do that most efficiently?
-           //copy res_row to dest
-
-           //mzd_row_clear_offset(dest_row,0,0);
-           //mzd_combine(dest,i,0,res_row,0,0,dest_row,0,0);
-
-           mzd_copy_row(dest,i,res_row,0);
-       }
-
-//endif
-    
-}
-#endif
-
-
 void FGLMStrategy::setupStandardMonomialsFromTables(){
 
      standardMonomialsFromVector.resize(varietySize, from);
@@ -117,32 +37,26 @@ void FGLMStrategy::setupStandardMonomialsFromTables(){
      }
 
 }
-#if 0
-void FGLMStrategy::writeTailToRow(MonomialSet tail, mzd_t* row){
-
-    MonomialSet::const_iterator it=tail.begin();
-    MonomialSet::const_iterator end=tail.end();
-            //optimize that;
-    while(it!=end){
-        idx_type tail_idx=standardMonomialsFrom2Index[*it];
-        mzd_write_bit(row,0, tail_idx,1);
-        it++;
-    }
-}
-#else
-void FGLMStrategy::writeTailToRow(MonomialSet tail, mzd_t* row){
+void FGLMStrategy::writeTailToRow(MonomialSet tail, SparseRow& row){
 
+    row.clear();
     MonomialSet::exp_iterator it=tail.expBegin();
     MonomialSet::exp_iterator end=tail.expEnd();
-            //optimize that;
     while(it!=end){
-        idx_type tail_idx=standardExponentsFrom2Index[*it];
-        mzd_write_bit(row,0, tail_idx,1);
+        row.push_back(standardExponentsFrom2Index[*it]);
         it++;
     }
+    std::sort(row.begin(), row.end());
 }
-#endif
-void FGLMStrategy::writeRowToVariableDivisors(mzd_t* row, Monomial lm){
+void FGLMStrategy::writeRowToVariableDivisors(const SparseRow& row, Monomial lm){
+    TableEntryVector entries;
+    variableDivisors(lm, entries);
+    for(std::size_t i=0;i<entries.size();i++){
+        multiplicationTables[entries[i].first][entries[i].second]=row;
+    }
+}
+void FGLMStrategy::variableDivisors(Monomial lm, TableEntryVector& entries){
+    entries.clear();
     Monomial::const_iterator it_lm=lm.begin();
     Monomial::const_iterator end_lm=lm.end();
     Exponent exp=lm.exp();
@@ -152,7 +66,6 @@ void FGLMStrategy::writeRowToVariableDivisors(mzd_t* row, Monomial lm){
         idx_type our_var_index=ring2Index[ring_var_index];
         Exponent divided=exp.removeConst(ring_var_index);
         if (standardMonomialsFrom.owns(divided)){
-            mzd_t* mat=multiplicationTables[our_var_index];
             size_t divided_index=standardExponentsFrom2Index[divided];
 
             if (first){
@@ -160,57 +73,24 @@ void FGLMStrategy::writeRowToVariableDivisors(mzd_t* row, Monomial lm){
                 monomial2MultiplicationMatrixRowIndex[lm]=divided_index;
                 first=false;
             }
-            if (transposed){
-              for(std::size_t j=0;j<varietySize;j++){
-                    mzd_write_bit(mat, j, divided_index, mzd_read_bit(row,0,j));
-                }
-            } else {
-                
-                /*mzd_t* window=mzd_init_window(mat,divided_index,0,divided_index+1,varietySize);
-                mzd_copy(window,row);
-                mzd_free_window(window);*/
-                
-                mzd_copy_row(mat, divided_index, row,0);
-                
-                /*for(j=0;j<varietySize;j++){
-                    mzd_write_bit(mat, divided_index, j, mzd_read_bit(row,0,j));
-                }*/
-            }
+            entries.push_back(std::make_pair(our_var_index, divided_index));
         }
         it_lm++;
     }
 }
 
-void transpose_window_to_row(mzd_t* transposed_vec, mzd_t* window){
-    int i;
-    const int n=window->nrows;
-    for(i=0;i<n;i++){
-        mzd_write_bit(transposed_vec,0,i, mzd_read_bit(window,i,0));
-    }
-}
-Polynomial FGLMStrategy::rowToPoly(mzd_t* row){
+Polynomial FGLMStrategy::rowToPoly(const SparseRow& row){
     MonomialVector vec;
-    for(std::size_t i=0;i<varietySize;i++){
-        if (mzd_read_bit(row,0,i)==1){
-            vec.push_back(standardMonomialsFromVector[i]);
-        }
+    for(std::size_t i=0;i<row.size();i++){
+        vec.push_back(standardMonomialsFromVector[row[i]]);
     }
     return add_up_monomials(vec, to);
 }
 
 void FGLMStrategy::setupMultiplicationTables(){
     
-    //first we write into rows, later we transpose
-    //algorithm here
-    multiplicationTables.resize(nVariables);
-    tableXRowYIsMonomialFromWithIndex.resize(nVariables);
-    for(std::size_t i=0; i < nVariables;i++){
-        multiplicationTables[i]=mzd_init(varietySize,varietySize);
-        tableXRowYIsMonomialFromWithIndex[i].resize(varietySize);
-        for(std::size_t j=0;j<varietySize;j++){
-            tableXRowYIsMonomialFromWithIndex[i][j]=-1;
-        }
-    }
+    //rows are the normal forms of standard monomials times the variable
+    multiplicationTables.assign(nVariables, SparseRowMatrix(varietySize));
     
     //standard monomials
     
@@ -223,12 +103,10 @@ void FGLMStrategy::setupMultiplicationTables(){
             idx_type our_var_index=ring2Index[ring_var_index];
             Monomial divided=m / Variable(ring_var_index, m.ring());
             size_t divided_index=standardMonomialsFrom2Index[divided];
-            mzd_t* mat=multiplicationTables[our_var_index];
-            mzd_write_bit(mat, divided_index,i, 1);
-            tableXRowYIsMonomialFromWithIndex[our_var_index][divided_index]=i;
+            SparseRowMatrix& mat=multiplicationTables[our_var_index];
+            mat[divided_index].assign(1, i);
             //finally treat the "edge" case: m*v->m, where v divides m
-            mzd_write_bit(mat,i,i,1);
-            tableXRowYIsMonomialFromWithIndex[our_var_index][i]=i;
+            mat[i].assign(1, i);
             it++;
         }
 
@@ -236,19 +114,17 @@ void FGLMStrategy::setupMultiplicationTables(){
     }
     
     //leading monomials from gb: vertices/
-    mzd_t* row=mzd_init(1, varietySize);
+    SparseRow row;
     ReductionStrategy::const_iterator start(gbFrom.begin()), 
       finish(gbFrom.end());
     while (start != finish){
         Monomial lm = start->lead;
         MonomialSet tail = start->tail.set();
-        mzd_row_clear_offset(row,0,0);
         writeTailToRow(tail, row);
         writeRowToVariableDivisors(row,lm);
 
         ++start;
     }
-    mzd_free(row);
     //edges
     MonomialSet edges=standardMonomialsFrom.cartesianProduct(varsSet).
         diff(standardMonomialsFrom).diff(leadingTermsFrom);
@@ -264,14 +140,13 @@ void FGLMStrategy::setupMultiplicationTables(){
     MonomialVector::reverse_iterator end_edges=edges_vec.rend();
     edgesUnitedVerticesFrom=edges.unite(leadingTermsFrom);
     
-    mzd_t* multiplied_row=mzd_init(1,varietySize);
-    mzd_t* reduced_problem_to_row=mzd_init(1,varietySize);
-    
-    mzd_t* acc1=mzd_init(1, varietySize);
-    mzd_t* acc2=mzd_init(1, varietySize);
+    //the rows of edges are computed after the (cheap) bookkeeping for all of
+    //them; each row of a table is written by one edge at most
+    std::vector<EdgeRow> edge_rows;
+    edge_rows.reserve(edges_vec.size());
+    std::vector<IndexVector> written_by(nVariables, IndexVector(varietySize, -1));
     
     while(it_edges!=end_edges){
-        mzd_row_clear_offset(multiplied_row, 0, 0);
         Monomial m=*it_edges;
 
         MonomialSet candidates=Polynomial(edgesUnitedVerticesFrom.divisorsOf(m)).gradedPart(m.deg()-1).set();
@@ -282,99 +157,88 @@ void FGLMStrategy::setupMultiplicationTables(){
 
         PBORI_ASSERT (v_m.deg()==1);
         Variable var=*v_m.variableBegin();
-        mzd_t* mult_table=multiplicationTableForVariable(var);
-        
-        findVectorInMultTables(reduced_problem_to_row, reduced_problem_to);
-
-        if (!(transposed)){
-            
-        //standardMonomialsFrom2Index[reduced_problem_to];
-        
-        //highly inefficient/far to many allocations
-        
-        //mzd_mul expects second arg to be transposed
-        //which is a little bit tricky as we multiply from left
-        //mzd_t* transposed_mult_table=mzd_transpose(NULL, mult_table);
-        
-        //mzd_mul_naiv(multiplied_row,reduced_problem_to_row, mult_table);
-        #if 0
-        mult_by_combining_rows(multiplied_row, reduced_problem_to_row, 
-            mult_table, acc1, acc2,tableXRowYIsMonomialFromWithIndex[ring2Index[var.index()]]);
-        #else
-        _mzd_mul_va(multiplied_row, reduced_problem_to_row, mult_table, 1);
-        #endif
-        } else {
-            //mzd_t* transposed_vec=mzd_init(1,varietySize);
-            //PBORI_ASSERT (window->nrows==varietySize);
-            //PBORI_ASSERT (window->ncols==1);
-            //transpose_window_to_row(transposed_vec, window);
-            _mzd_mul_va(multiplied_row, reduced_problem_to_row, mult_table, FALSE);
-            //mzd_free(transposed_vec);
+        EdgeRow edge;
+        edge.table=ring2Index[var.index()];
+        edge.source=std::make_pair(
+            monomial2MultiplicationMatrix[reduced_problem_to],
+            monomial2MultiplicationMatrixRowIndex[reduced_problem_to]);
+        variableDivisors(m, edge.entries);
+        for(std::size_t i=0;i<edge.entries.size();i++){
+            written_by[edge.entries[i].first][edge.entries[i].second]=
+                edge_rows.size();
         }
-
-        writeRowToVariableDivisors(multiplied_row, m);
-        //matrices are transposed, so now we have write to columns
-        
-        //mzd_free(transposed_mult_table);
-        //mzd_free_window(window);
+        edge_rows.push_back(edge);
         it_edges++;
     }
-    mzd_free(reduced_problem_to_row);
-   
-    mzd_free(multiplied_row);
-    
-    mzd_free(acc1);
-    mzd_free(acc2);
-    
-    //transposeMultiplicationTables();
-    
-    {
-        #ifdef DRAW_MATRICES
-      for(std::size_t i=0;i<multiplicationTables.size();i++){
-            char matname[255];
-            sprintf(matname,"mult_table%d.png",(int)i);
+    computeEdgeRows(edge_rows, written_by);
+}
 
-            draw_matrix(multiplicationTables[i],matname);
+void FGLMStrategy::computeEdgeRows(const std::vector<EdgeRow>& edge_rows,
+    const std::vector<IndexVector>& written_by){
+
+    std::size_t nthreads=(nThreads>0? nThreads:
+        std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                              edge_rows.size()/parallel_cutoff+1));
+    //an edge only depends on smaller ones, which are claimed before
+    std::atomic<std::size_t> next(0);
+    std::atomic<bool> failed(false);
+    std::vector<std::atomic<bool> > done(edge_rows.size());
+    std::vector<std::exception_ptr> errors(nthreads);
+
+    //wait for the row at (table, row_idx) to be written (false on failure)
+    auto ready=[&](idx_type table, std::size_t row_idx) -> bool {
+        const int edge_idx=written_by[table][row_idx];
+        if (edge_idx>=0){
+            while(!done[edge_idx].load(std::memory_order_acquire)){
+                if (failed.load()) return false;
+                std::this_thread::yield();
+            }
         }
-        #endif
-    }
-}
-void FGLMStrategy::findVectorInMultTables(mzd_t* dst, Monomial m){
-    mzd_t* mat=multiplicationTables[monomial2MultiplicationMatrix[m]];
-    size_t idx=monomial2MultiplicationMatrixRowIndex[m];
-    if (!(transposed))
-        mzd_submatrix(dst, mat, idx, 0, idx+1, varietySize);
-    else{
-        const int n=varietySize;
-        int i;
-        for(i=0;i<n;i++){
-            mzd_write_bit(dst, 0, i, mzd_read_bit(mat,i,idx));
+        return true;
+    };
+    auto run=[&](std::size_t thread_idx){
+        try {
+            SparseRowMatrix::Accumulator acc(varietySize);
+            SparseRow row;
+            for(std::size_t idx=next++;idx<edge_rows.size();idx=next++){
+                const EdgeRow& edge=edge_rows[idx];
+                const SparseRowMatrix& mult_table=multiplicationTables[edge.table];
+                if (!ready(edge.source.first, edge.source.second)) return;
+                const SparseRow& source=
+                    multiplicationTables[edge.source.first][edge.source.second];
+                for(std::size_t i=0;i<source.size();i++){
+                    if (!ready(edge.table, source[i])) return;
+                    acc.add(mult_table[source[i]]);
+                }
+                acc.extract(row);
+                for(std::size_t i=0;i<edge.entries.size();i++){
+                    multiplicationTables[edge.entries[i].first]
+                        [edge.entries[i].second]=row;
+                }
+                done[idx].store(true, std::memory_order_release);
+            }
         }
-    }
-}
-void clear_mat(mzd_t* mat) {
-  for(int i = 0; i < mat->nrows; ++i) {
-    mzd_row_clear_offset(mat,i,0);
-  }
-}
-void FGLMStrategy::transposeMultiplicationTables(){
-    //From now on, we multiply, so here we transpose
-    mzd_t* new_mat=mzd_init(varietySize,varietySize);
-    mzd_t* swap;
-    for(std::size_t i=0;i<multiplicationTables.size();i++){
-        //unnecassary many allocations of matrices
-        //mzd_t* new_mat=mzd_init(varietySize,varietySize);
-        clear_mat(new_mat);
-        mzd_transpose(new_mat, multiplicationTables[i]);
-        
-        swap=new_mat;
-        new_mat=multiplicationTables[i];
-        multiplicationTables[i]=swap;
-        //mzd_free(new_mat);
+        catch (...) {
+            errors[thread_idx]=std::current_exception();
+            failed=true;
+        }
+    };
 
+    std::vector<std::thread> threads;
+    for(std::size_t i=1;i<nthreads;i++){
+        threads.push_back(std::thread(run, i));
+    }
+    run(0);
+    std::for_each(threads.begin(), threads.end(),
+                  std::mem_fn(&std::thread::join));
+    for(std::size_t i=0;i<nthreads;i++){
+        if PBORI_UNLIKELY(errors[i])
+            std::rethrow_exception(errors[i]);
     }
-    mzd_free(new_mat);
-    transposed=(!(transposed));
+}
+void FGLMStrategy::findVectorInMultTables(SparseRow& dst, Monomial m){
+    dst=multiplicationTables[monomial2MultiplicationMatrix[m]]
+        [monomial2MultiplicationMatrixRowIndex[m]];
 }
 void FGLMStrategy::analyzeGB(const ReductionStrategy& gb){
 
@@ -427,115 +291,38 @@ public:
         this->firstNonZeroIndex=firstNonZeroIndex;
     }
 };
-#if 0
-FGLMStrategy::IndexVector FGLMStrategy::rowVectorIsLinearCombinationOfRows(mzd_t* mat, mzd_t* v){
-    //returns vector with indices, where the coefficients in this linear combination are 1
-    //if no such combination exists, raises Exception
-    #ifdef DRAW_MATRICES
-    static int round=0;
-    round++;
-    PBORI_ASSERT (mat->ncols==varietySize);
-    PBORI_ASSERT (v->ncols==varietySize);
-    PBORI_ASSERT (v->nrows==1);
-    #endif
-    mzd_t* row_combined=mzd_stack(NULL, mat, v);
-    {        
-        #ifdef DRAW_MATRICES
-            char matname[255];
-            sprintf(matname,"row_combined%d.png",round);
-
-            draw_matrix(row_combined,matname);
-        #endif
-    }
-    mzd_t* col_combined=mzd_transpose(NULL, row_combined);
-    mzd_free(row_combined);
-    
-    mzd_echelonize_m4ri(col_combined,TRUE,0,NULL,NULL);
-    {        
-        #ifdef DRAW_MATRICES
-            char matname[255];
-            sprintf(matname,"col_reduced%d.png",round);
-
-            draw_matrix(col_combined,matname);
-        #endif
-    }
-    const int cols=col_combined->ncols;
-    const int rows=col_combined->nrows;
-    PBORI_ASSERT (rows>=cols-1);
-    const int ngenerators=cols-1;
-    const int last_col=cols-1;
-    int i;
-    IndexVector res;
-    
-    //first col-1 cols are linear independend -> reduced row echelon form has unimat het
-    for(i=rows-1;i>ngenerators-1;i--){
-        PBORI_ASSERT(i>=last_col);
-        if (mzd_read_bit(col_combined,i,last_col)==1){
-            //no inhomgeneous solution exists
-            mzd_free(col_combined);
-            FGLMNoLinearCombinationException ex;
+FGLMStrategy::IndexVector FGLMStrategy::rowVectorIsLinearCombinationOfRows(
+    const SparseRowMatrix& w, const SparseRowMatrix& wCombinations,
+    const SparseRow& v, SparseRow& remainder, SparseRow& combination){
+
+    remainder=v;
+    SparseRow sum;
+    std::size_t pos=0;
+    while(pos<remainder.size()){
+        const std::size_t i=remainder[pos];
+        const int row_idx=rowStartingWithIndex[i];
+        if (row_idx<0){
+            remainder.erase(remainder.begin(), remainder.begin()+pos);
+            accumulator.extract(combination);
+            FGLMNoLinearCombinationException ex(i);
             throw ex;
-            
         }
-    }
-    for(i=ngenerators-1;i>=0;i--){
-        PBORI_ASSERT(i<last_col);
-        if (mzd_read_bit(col_combined,i, last_col)==1){
-            PBORI_ASSERT(mzd_read_bit(col_combined,i,i)==1);
-            res.push_back(i);
-        }
-    }
-    mzd_free(col_combined);
-    
-    return res;
-}
-#else
-FGLMStrategy::IndexVector FGLMStrategy::rowVectorIsLinearCombinationOfRows(mzd_t* mat, mzd_t* v){
-    const int d=mat->nrows-1;
-    mzd_row_clear_offset(mat,d,0);
-    PBORI_ASSERT (mat->ncols==2*varietySize);
-    
-    //mzd_t* copy_v_into=mzd_init_window(mat,d,0,d+1,varietySize);
-    //mzd_copy(copy_v_into,v);
-    //mzd_free_window(copy_v_into);
-    
-    mzd_copy_row(mat,d,v,0);
-    //mzd_row_clear_offset(mat,d,varietySize);//might be random data at the end as mat is wider
-
-
-    for(std::size_t i=0;i<varietySize;i++){
-        if (mzd_read_bit(mat,d,i)==1){
-            bool succ=false;
-            int row_idx=rowStartingWithIndex[i];
-            if (row_idx>=0){
-                succ=true;
-                int standard_idx;
-                if ((standard_idx=rowIsStandardMonomialToWithIndex[row_idx])>=0){
-                    mzd_write_bit(mat,d,i,0);
-                    const int standard_idx_with_offset=varietySize+standard_idx;
-                    mzd_write_bit(mat,d,standard_idx_with_offset,(1+mzd_read_bit(mat,d,standard_idx_with_offset))%2);
-                } else {
-                    mzd_row_add_offset(mat, d, row_idx, i);
-                }
-                
-            }
-
-            if (!(succ)){
-                FGLMNoLinearCombinationException ex(i);
-                throw ex;
-                
-            }
-        }
-    }
-    IndexVector res;
-    for(int i=0;i<d;i++){
-        if (mzd_read_bit(mat,d,i+varietySize)==1){
-            res.push_back(i);
+        const int standard_idx=rowIsStandardMonomialToWithIndex[row_idx];
+        if (standard_idx>=0){
+            //row is the unit vector for i
+            ++pos;
+            accumulator.toggle(standard_idx);
+        } else {
+            SparseRowMatrix::add(remainder.begin()+pos, remainder.end(),
+                                 w[row_idx], sum);
+            remainder.swap(sum);
+            pos=0;
+            accumulator.add(wCombinations[row_idx]);
         }
     }
-    return res;
+    accumulator.extract(combination);
+    return IndexVector(combination.begin(), combination.end());
 }
-#endif
 PolynomialVector FGLMStrategy::main(){
     PolynomialVector F;
     const Monomial monomial_one(to);
@@ -546,103 +333,85 @@ PolynomialVector FGLMStrategy::main(){
     }
     //variables are oriented at Tim Wichmanns Diploma thesis
 
-    mzd_t* acc1=mzd_init(1, varietySize);
-    mzd_t* acc2=mzd_init(1, varietySize);
-
+    //candidates are kept in a heap, smallest (w.r.t. to) on top; each one is
+    //generated once (from its divisor without the smallest variable)
+    typedef std::vector<Exponent> ExponentVector;
     
-    typedef std::set<Monomial> MonomialSetSTL;
-    
-    MonomialSetSTL C;
+    ExponentVector C;
+    const ExpGreater greater(to);
 
-    lm2Index_map_type mon2index;
     Exponent::idx_map_type exp2index;
     //initialize with one monomial
-    mzd_t* v=mzd_init(varietySize, varietySize);//write vectors in rows;
-    mzd_t* w=mzd_init(varietySize+1, varietySize*2);
-    IndexVector w_start_indices;
+    SparseRowMatrix v(varietySize);//write vectors in rows;
+    //reduced rows and their combinations of the vectors in v
+    SparseRowMatrix w(varietySize), w_combinations(varietySize);
     rowStartingWithIndex.resize(varietySize);
     rowIsStandardMonomialToWithIndex.resize(varietySize);
     for(std::size_t i=0;i<rowStartingWithIndex.size();i++){
         rowStartingWithIndex[i]=-1;
         rowIsStandardMonomialToWithIndex[i]=-1;
     }
-    MonomialSet b_set=monomial_one.set();
     MonomialVector b;
     b.push_back(monomial_one);
-    mzd_write_bit(v,0,0,1);
-    mzd_write_bit(w,0,0,1);
-    mzd_write_bit(w,0,varietySize+0,1);
-    w_start_indices.push_back(0);
+    v[0].assign(1, 0);
+    w[0].assign(1, 0);
+    w_combinations[0].assign(1, 0);
     rowStartingWithIndex[0]=0;
     rowIsStandardMonomialToWithIndex[0]=0;
 
-    VariableVector varsVectorTo;
-    varsVectorTo.reserve(varsVector.size());
-    for(std::size_t i=0;i<varsVector.size();i++){
-      varsVectorTo.push_back(to.coerce(varsVector[i]));
-      C.insert(varsVectorTo.back());
+    for(std::size_t i=0;i<index2Ring.size();i++){
+        C.push_back(monomial_one.exp().insertConst(index2Ring[i]));
     }
+    std::make_heap(C.begin(), C.end(), greater);
 
-    mon2index[monomial_one]=0;
     exp2index[monomial_one.exp()]=0;
-    mzd_t* v_d=mzd_init(1,varietySize);
+    SparseRow v_d, remainder, combination;
     
     while(!(C.empty())){
         const int d=b.size();
-        Monomial m=*(C.begin());
-
-        C.erase(C.begin());
+        std::pop_heap(C.begin(), C.end(), greater);
+        const Exponent m_exp=C.back();
+        C.pop_back();
         
-        PBORI_ASSERT(m!=monomial_one);
-        Polynomial divisors(to);
-        PBORI_ASSERT(b_set.containsDivisorsOfDecDeg(m)==(Polynomial(b_set.divisorsOf(m)).gradedPart(m.deg()-1).length()==m.deg()));
-        if (b_set.containsDivisorsOfDecDeg(m)/*varsM=Zm,Ecke oder Standard Monom*/) {
-            Polynomial divisors=Polynomial(b_set.divisorsOf(m)).gradedPart(m.deg()-1);
-            mzd_row_clear_offset(v_d,0,0);
+        PBORI_ASSERT(m_exp.deg()>0);
+        //look up the divisors m/x_i in b
+        int j=-1;
+        Exponent::const_iterator it_m=m_exp.begin(), end_m=m_exp.end();
+        for(;it_m!=end_m;++it_m){
+            Exponent::idx_map_type::const_iterator found=
+                exp2index.find(m_exp.removeConst(*it_m));
+            if (found==exp2index.end()) break;
+            if (j<0) j=found->second;
+        }
+        if (it_m==end_m/*varsM=Zm,Ecke oder Standard Monom*/) {
+            const Monomial m(m_exp, to);
             PBORI_ASSERT(varietySize>0);
             bool is_standard_monomial_from=false;
             
             if (edgesUnitedVerticesFrom.owns(m)){
                 findVectorInMultTables(v_d, m);
             } else {
-                if (standardMonomialsFrom.owns(m)){
-                    mzd_write_bit(v_d,0, standardMonomialsFrom2Index[m],1);
+                Exponent::idx_map_type::const_iterator standard=
+                    standardExponentsFrom2Index.find(m_exp);
+                if (standard!=standardExponentsFrom2Index.end()){
+                    v_d.assign(1, standard->second);
                     is_standard_monomial_from=true;
                 } else{
-                    Exponent b_j=*divisors.expBegin();
-                    int j=exp2index[b_j];
-                    Exponent x_i_m=(m.exp()-b_j);
+                    Exponent x_i_m=(m_exp-b[j].exp());
                     PBORI_ASSERT (x_i_m.deg()==1);
-                    //Variable x_i=*x_i_m.variableBegin();
                     idx_type our_x_i_index=ring2Index[*x_i_m.begin()];
-                    mzd_t* mult_table=multiplicationTables[our_x_i_index];//multiplicationTableForVariable(x_i);
-                    mzd_t* v_j=mzd_init_window(v,j,0,j+1,varietySize);
-
-                    PBORI_ASSERT (v_j->nrows==1);
-                    PBORI_ASSERT ( v_j->ncols==varietySize);
-                    if (transposed)
-                        v_d=_mzd_mul_va(v_d, v_j, mult_table, FALSE);
-                    else{
-                        #if 0
-                        mult_by_combining_rows(v_d, v_j, mult_table, acc1, acc2, tableXRowYIsMonomialFromWithIndex[our_x_i_index]);
-                        #else
-                        _mzd_mul_va(v_d, v_j, mult_table, 1);
-                        #endif
-                    }
-                    mzd_free_window(v_j);
+                    multiplicationTables[our_x_i_index].multiply(v[j], v_d,
+                                                                 accumulator);
                 }
                 
             }
             
-            PBORI_ASSERT (v_d->nrows==1);
-            PBORI_ASSERT (v_d->ncols==varietySize);
-            mzd_t* w_window=mzd_init_window(w,0,0,d+1,2*varietySize);
-            //mzd_t* w_row_window=mzd_init_window(w,d,0,d+1,varietySize);
             try
             {    
                 
                 
-                IndexVector lin_combination=rowVectorIsLinearCombinationOfRows(w_window,  v_d);
+                IndexVector lin_combination=rowVectorIsLinearCombinationOfRows(
+                    w, w_combinations, v_d, remainder, combination);
                 MonomialVector p_vec;
                 for(std::size_t i=0;i<lin_combination.size();i++){
                     PBORI_ASSERT (lin_combination[i]<b.size());
@@ -656,13 +425,14 @@ PolynomialVector FGLMStrategy::main(){
             catch (FGLMNoLinearCombinationException& e)
             {   
 
-                b_set=b_set.unite(m.diagram());
                 b.push_back(m);
                 
                 rowStartingWithIndex[e.firstNonZeroIndex]=d;
-                mzd_write_bit(w,d,varietySize+d,1);
+                w[d].swap(remainder);
+                combination.push_back(d);
+                w_combinations[d].swap(combination);
                 if (is_standard_monomial_from){
-                    std::size_t from_idx=standardMonomialsFrom2Index[m];
+                    std::size_t from_idx=standardExponentsFrom2Index[m_exp];
                     if (e.firstNonZeroIndex==from_idx){
                         //we assume, the row is untached
                         rowIsStandardMonomialToWithIndex[d]=d;
@@ -670,45 +440,30 @@ PolynomialVector FGLMStrategy::main(){
                     } else {
                         const int reduced_with_this_row=rowStartingWithIndex[from_idx];
                         PBORI_ASSERT(reduced_with_this_row>=0);
-                        mzd_row_clear_offset(w, reduced_with_this_row,0);
-                        mzd_write_bit(w, reduced_with_this_row, from_idx,1);
-                        mzd_write_bit(w, reduced_with_this_row, varietySize+d,1);
+                        w[reduced_with_this_row].assign(1, from_idx);
+                        w_combinations[reduced_with_this_row].assign(1, d);
                         rowIsStandardMonomialToWithIndex[reduced_with_this_row]=d;
                         //still generate the same vector space
                     }
                 }
-                /*mzd_t* copy_window=mzd_init_window(v,d,0,d+1,varietySize);
-                mzd_copy(copy_window, v_d);
-                mzd_free_window(copy_window);*/
-                mzd_copy_row(v,d,v_d,0);
+                v[d].swap(v_d);
                 
-                idx_type m_begin=*m.begin();
-                for(std::size_t i=0;(i<varsVectorTo.size())&&(index2Ring[i]<m_begin);i++){
-                  Variable var=varsVectorTo[i];
-                    if (!(m.reducibleBy(var))){
-                      Monomial m_v= var*m;
-                        C.insert(m_v);
-                    }
+                idx_type m_begin=*m_exp.begin();
+                for(std::size_t i=0;(i<index2Ring.size())&&(index2Ring[i]<m_begin);i++){
+                    C.push_back(m_exp.insertConst(index2Ring[i]));
+                    std::push_heap(C.begin(), C.end(), greater);
                 }
-                mon2index[m]=b.size()-1;
-                exp2index[m.exp()]=b.size()-1;
+                exp2index[m_exp]=b.size()-1;
             }
 
-            mzd_free_window(w_window);
         } 
         
     }
-    mzd_free(w);
-    mzd_free(v_d);
-    mzd_free(v);
 
     for(std::size_t i=0;i<addTheseLater.size();i++){
         F.push_back(to.coerce(addTheseLater[i]));
     }
     
-    mzd_free(acc1);
-    mzd_free(acc2);
-
 #ifndef PBORI_NDEBUG
     for (std::size_t idx = 0; idx < F.size(); ++idx) {
       PBORI_ASSERT(to.id() == F[idx].ring().id());
@@ -726,20 +481,15 @@ void FGLMStrategy::testMultiplicationTables(){
         PBORI_ASSERT (v.index()>=i);
         for (std::size_t j=0;j<standardMonomialsFromVector.size(); j++){
             Monomial m=standardMonomialsFromVector[j];
-            mzd_t* table=multiplicationTableForVariable(v);
+            const SparseRow& row=multiplicationTableForVariable(v)[j];
             if (m==v){continue;}
             
             Polynomial product=reducedNormalFormInFromRing(m*v);
 
             MonomialSet product_set=product.diagram();
             Polynomial sum(0, product.ring());
-            for(std::size_t k=0;k<varietySize;k++){
-                Monomial m2=standardMonomialsFromVector[k];
-                
-                if (mzd_read_bit(table,j,k)==1){
-                    sum+=m2;
-                }
-
+            for(std::size_t k=0;k<row.size();k++){
+                sum+=standardMonomialsFromVector[row[k]];
             }
             if (sum!=product)
                 cout<<"v:"<<v<<"\tm:"<<m<<"\tsum:"<<sum<<"\tproduct:"<<product<<endl;
@@ -767,8 +517,8 @@ bool FGLMStrategy::canAddThisElementLaterToGB(Polynomial p){
     }*/
     return false;
 }
-FGLMStrategy::FGLMStrategy(const ring_with_ordering_type& from_ring, const ring_with_ordering_type& to_ring,  const PolynomialVector& gb)
-  : vars(from_ring), 
+FGLMStrategy::FGLMStrategy(const ring_with_ordering_type& from_ring, const ring_with_ordering_type& to_ring,  const PolynomialVector& gb, unsigned nthreads)
+  : nThreads(nthreads), vars(from_ring), 
 
    standardMonomialsFrom(from_ring),
    leadingTermsFrom(from_ring),
@@ -776,7 +526,6 @@ FGLMStrategy::FGLMStrategy(const ring_with_ordering_type& from_ring, const ring_
     gbFrom(from_ring), edgesUnitedVerticesFrom(from_ring), from(from_ring), to(to_ring){
 
     prot=false;
-    transposed=false;
 
     PolynomialVector::const_iterator it=gb.begin();
     PolynomialVector::const_iterator end=gb.end();
@@ -803,9 +552,16 @@ FGLMStrategy::FGLMStrategy(const ring_with_ordering_type& from_ring, const ring_
             cout<<"standard monomials tables..."<<endl;
         }
         setupStandardMonomialsFromTables();
+        accumulator=SparseRowMatrix::Accumulator(varietySize);
         if (prot)
             cout<<"multiplication tables..."<<endl;
         setupMultiplicationTables();
+        if (prot){
+            std::size_t nnz=0;
+            for(std::size_t i=0;i<multiplicationTables.size();i++)
+                nnz+=multiplicationTables[i].nnz();
+            cout<<"nonzero entries:"<<nnz<<endl;
+        }
 
 #ifndef PBORI_NDEBUG
         if (prot)
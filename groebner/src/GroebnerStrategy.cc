@@ -19,7 +19,7 @@
 #include <polybori/groebner/HasTRepOrExtendedProductCriterion.h>
 #include <polybori/groebner/ShorterEliminationLengthModified.h>
 #include <polybori/groebner/tables.h>
-#include <polybori/groebner/ExpGreater.h>
+#include <polybori/groebner/ExpOrderDispatch.h>
 #include <polybori/groebner/ChainCriterion.h>
 
 // for extended_product_criterion:
@@ -44,6 +44,7 @@
 #include <polybori/groebner/IsVariableOfIndex.h>
 #include <polybori/groebner/RedTailNth.h>
 #include <polybori/groebner/GetNthPoly.h>
+#include <polybori/groebner/BatchRedTail.h>
 #include <polybori/groebner/RankingVector.h>
 #include <sstream>
 
@@ -54,18 +55,24 @@ static Polynomial opposite_logic_mapping(Polynomial p){
     return map_every_x_to_x_plus_one(p)+1;
 }
 
-static std::vector<Polynomial> small_next_degree_spolys(GroebnerStrategy& strat, double f, int n){
-  std::vector<Polynomial> res;
+static std::vector<Polynomial> small_next_degree_spolys(GroebnerStrategy& strat, double f, int n, CDDForkJoin& forks){
+  std::vector<Pair> selected;
   PBORI_ASSERT(!(strat.pairs.pairSetEmpty()));
   strat.pairs.cleanTopByChainCriterion();
   deg_type deg=strat.pairs.queue.top().sugar;
   wlen_type wlen=strat.pairs.queue.top().wlen;
-  while((!(strat.pairs.pairSetEmpty())) &&(strat.pairs.queue.top().sugar<=deg) && (strat.pairs.queue.top().wlen<=wlen*f+2)&& (res.size()<(std::size_t)n)){
+  while((!(strat.pairs.pairSetEmpty())) &&(strat.pairs.queue.top().sugar<=deg) && (strat.pairs.queue.top().wlen<=wlen*f+2)&& (selected.size()<(std::size_t)n)){
     
     PBORI_ASSERT(strat.pairs.queue.top().sugar==deg);
-    res.push_back(strat.nextSpoly());
+    selected.push_back(strat.nextPair());
     strat.pairs.cleanTopByChainCriterion();
   }
+
+  // pair status is up to date now, the S-polynomials are independent
+  std::vector<Polynomial> res;
+  NextSpoly(strat.generators, strat.pairs.status).construct(selected.begin(),
+                                                            selected.end(),
+                                                            res, forks);
   return res;
   
 }
@@ -76,6 +83,8 @@ GroebnerStrategy::GroebnerStrategy(const GroebnerStrategy& orig):
   PairManagerFacade<GroebnerStrategy>(orig),
   generators(orig.generators),
   cache(orig.cache),
+  tableGenerators(orig.tableGenerators),
+  budget(orig.budget),
 
   reductionSteps(orig.reductionSteps),
   normalForms(orig.normalForms),
@@ -213,29 +222,31 @@ GroebnerStrategy::addHigherImplDelayedUsing4(const LiteralFactorization&
     //Monomial used_variables_m=p.usedVariables();
     Exponent used_variables = p.usedVariablesExp();
     Exponent e = p.leadExp();
-    if (e.size()>4) std::cerr<<"too many variables for table"<<std::endl;
+    if (e.size()>GroebnerTableGenerator::max_variables) std::cerr<<"too many variables for table"<<std::endl;
     
     std::vector<char> ring_2_0123(ring.nVariables());
-    std::vector<idx_type> back_2_ring(4);
+    std::vector<idx_type> back_2_ring(used_variables.size());
     set_up_translation_vectors(ring_2_0123, back_2_ring, used_variables);
-    unsigned int p_code=p2code_4(p, ring_2_0123);
-    if ((get_table_entry4(ring, p_code,0) == p_code) &&
-        (get_table_entry4(ring, p_code,1) == 0)){
+    unsigned int p_code=p2code_5(p, ring_2_0123);
+    std::vector<unsigned int> entries;
+    get_table_entries(*tableGenerators, ring, used_variables, p_code,
+                      entries);
+    if ((entries.size() == 1) && (entries[0] == p_code)){
       return false;
     }
     
     bool can_add_directly=true;
-    for(int i=0;get_table_entry4(ring, p_code,i)!=0;i++){
-      unsigned int impl_code=get_table_entry4(ring, p_code,i);
+    for(std::size_t i=0;i<entries.size();i++){
+      unsigned int impl_code=entries[i];
 
         if ((include_orig) ||(p_code!=impl_code)){
-          Polynomial p_i=code_2_poly_4(ring, impl_code, back_2_ring);
+          Polynomial p_i=code_2_poly(ring, impl_code, back_2_ring);
             Exponent e_i=p_i.leadExp();
 
             if (include_orig || (e_i != e) ) {
 	      p_i = multiply_with_literal_factors(literal_factors, p_i);
 	      impl.push_back(p_i);
-	      can_add_directly &= generators.minimalLeadingTerms.divisorsOf(p_i.leadExp()).isZero();
+	      can_add_directly &= !generators.minimalLeadingTerms.containsDivisorOf(p_i.leadExp());
                 //e_i is wrong here, have to multiply
             }
         }
@@ -283,28 +294,29 @@ GroebnerStrategy::add4ImplDelayed(const Polynomial& p, const Exponent& lm_exp,
     BoolePolyRing ring(p.ring());
 
     std::vector<char> ring_2_0123(ring.nVariables());
-    std::vector<idx_type> back_2_ring(4);
+    std::vector<idx_type> back_2_ring(used_variables.size());
     set_up_translation_vectors(ring_2_0123, back_2_ring, used_variables);
     
-    unsigned int p_code=p2code_4(p, ring_2_0123);
+    unsigned int p_code=p2code_5(p, ring_2_0123);
+    std::vector<unsigned int> entries;
+    get_table_entries(*tableGenerators, ring, used_variables, p_code,
+                      entries);
 
-    if ((get_table_entry4(ring, p_code, 0)==p_code) &&
-        (get_table_entry4(ring, p_code, 1)==0)) {
+    if ((entries.size()==1) && (entries[0]==p_code)) {
       return false;
     }
     
-    int i;
     bool can_add_directly=true;
 
-    for(i=0;get_table_entry4(ring, p_code,i)!=0;i++){
-      unsigned int impl_code=get_table_entry4(ring, p_code, i);
+    for(std::size_t i=0;i<entries.size();i++){
+      unsigned int impl_code=entries[i];
         if ((include_orig) ||(p_code!=impl_code)){
-          Polynomial p_i=code_2_poly_4(ring, impl_code, back_2_ring);
+          Polynomial p_i=code_2_poly(ring, impl_code, back_2_ring);
             Exponent e_i=p_i.leadExp();
 
             if ((include_orig) ||(e_i!=e)){
                 impl.push_back(p_i);
-                can_add_directly &= generators.minimalLeadingTerms.divisorsOf(e_i).isZero();
+                can_add_directly &= !generators.minimalLeadingTerms.containsDivisorOf(e_i);
             }
         }
     }
@@ -340,17 +352,17 @@ std::vector<Polynomial>
 GroebnerStrategy::treatVariablePairs(PolyEntryReference entry){
 
   const PolyEntry& e = entry;
-  if (have_ordering_for_tables(e.p.ring()) ||
-      (have_base_ordering_for_tables(e.p.ring()) && e.p.inSingleBlock())) {
+  int max_uv=tableVariables(e.p);
+  if (max_uv>0) {
     int uv=e.usedVariables.deg();
-    if (uv<=4){
+    if (uv<=max_uv){
       return add4ImplDelayed(entry);
     } 
     else {
       int uv_opt = uv-e.literal_factors.factors.size()-2*e.literal_factors.var2var_map.size();
       ////should also be proofable for var2var factors
       PBORI_ASSERT(uv_opt==e.literal_factors.rest.nUsedVariables());//+2*var2var_map.size());
-      if (uv_opt<=4){
+      if (uv_opt<=max_uv){
         return addHigherImplDelayedUsing4(entry);
       }
     }
@@ -544,8 +556,11 @@ GroebnerStrategy::minimalizeAndTailReduce(){
 
     MonomialSet minelts = minimal_elements(generators.minimalLeadingTerms);
     std::vector<Polynomial> result(minelts.size(), minelts.ring());
-    std::transform(minelts.rExpBegin(), minelts.rExpEnd(), result.rbegin(), 
-                   RedTailNth(generators));
+    if (optBatchTailReduce)
+      result = BatchRedTail(generators)(minelts.expBegin(), minelts.expEnd());
+    else
+      std::transform(minelts.rExpBegin(), minelts.rExpEnd(), result.rbegin(),
+                     RedTailNth(generators));
 
     generators.optRedTailDegGrowth = tail_growth_bak;
     return result;
@@ -567,54 +582,50 @@ void GroebnerStrategy::addGeneratorTrySplit(const Polynomial & p, bool is_minima
   PBORI_ASSERT(generators.empty() || p.ring().id() == generators[0].p.ring().id());
   std::vector<Polynomial> impl;
 
-  if ((have_ordering_for_tables(p.ring())) ||
-      ((have_base_ordering_for_tables(p.ring())) &&
-       (p.inSingleBlock()))) { 
+  int max_uv=tableVariables(p);
+  if (max_uv>0) { 
 
     int u_v=p.usedVariablesExp().deg();
-    if  (u_v<=4) {
+    if  (u_v<=max_uv) {
 
       impl = add4ImplDelayed(p, p.leadExp(), p.usedVariablesExp());
-    } else {
-
-      if (((optAllowRecursion) && (u_v<=15))||(u_v<=10)){
-
-        LiteralFactorization f(p);
-        if (f.rest.usedVariablesExp().deg()<=4){
-
-          impl = addHigherImplDelayedUsing4(f);
-        } else {
-          deg_type rest_lead_exp_deg=f.rest.leadExp().deg();
-          deg_type rest_used_variables_deg=f.rest.usedVariablesExp().deg();
-          if ((optAllowRecursion) &&(is_minimal) && 
-
-            (
-            (rest_used_variables_deg<=rest_lead_exp_deg+2)||
-            ((rest_lead_exp_deg<=6)
-            &&(rest_used_variables_deg<=rest_lead_exp_deg+3))||
-            ((rest_lead_exp_deg<=4)
-            &&(rest_used_variables_deg<=rest_lead_exp_deg+4))||
-            ((rest_lead_exp_deg<=3)
-            &&(rest_used_variables_deg<=rest_lead_exp_deg+5))||
-            ((rest_lead_exp_deg<=2)
-            &&(rest_used_variables_deg<=rest_lead_exp_deg+7))))
-          {
-                        //orig +2
-            log("Recursive call");
-            impl=full_implication_gb(f.rest,*cache,*this);
-            int i;
-            int s=impl.size();
-            for(i=0;i<s;i++){
-              impl[i]=multiply_with_literal_factors(f,impl[i]);
-            }
+    } else if (((optAllowRecursion) && (u_v<=15))||(u_v<=10)){
+
+      LiteralFactorization f(p);
+      if (f.rest.usedVariablesExp().deg()<=max_uv){
+
+        impl = addHigherImplDelayedUsing4(f);
+      } else {
+        deg_type rest_lead_exp_deg=f.rest.leadExp().deg();
+        deg_type rest_used_variables_deg=f.rest.usedVariablesExp().deg();
+        if ((optAllowRecursion) &&(is_minimal) && 
+
+          (
+          (rest_used_variables_deg<=rest_lead_exp_deg+2)||
+          ((rest_lead_exp_deg<=6)
+          &&(rest_used_variables_deg<=rest_lead_exp_deg+3))||
+          ((rest_lead_exp_deg<=4)
+          &&(rest_used_variables_deg<=rest_lead_exp_deg+4))||
+          ((rest_lead_exp_deg<=3)
+          &&(rest_used_variables_deg<=rest_lead_exp_deg+5))||
+          ((rest_lead_exp_deg<=2)
+          &&(rest_used_variables_deg<=rest_lead_exp_deg+7))))
+        {
+                      //orig +2
+          log("Recursive call");
+          impl=full_implication_gb(f.rest,*cache,*this);
+          int i;
+          int s=impl.size();
+          for(i=0;i<s;i++){
+            impl[i]=multiply_with_literal_factors(f,impl[i]);
           }
         }
-
       }
 
     }
 
 
+
   } 
   if (impl.empty())
     addGenerator(p);
@@ -625,7 +636,7 @@ void GroebnerStrategy::addGeneratorTrySplit(const Polynomial & p, bool is_minima
       finish(impl.end());   
     for(; start != finish; ++start) {
       PBORI_ASSERT(!start->isZero());
-      if (generators.minimalLeadingTerms.divisorsOf(start->leadExp()).isZero())
+      if (!generators.minimalLeadingTerms.containsDivisorOf(start->leadExp()))
         addImplications(*start, implication_indices);
       else
         addGeneratorDelayed(*start);
@@ -634,6 +645,15 @@ void GroebnerStrategy::addGeneratorTrySplit(const Polynomial & p, bool is_minima
   }
 }
 
+unsigned GroebnerStrategy::tableVariables(const Polynomial& p) const {
+
+  if (have_ordering_for_tables(p.ring()) || optBlockTables)
+    return GroebnerTableGenerator::max_variables;
+  if (have_base_ordering_for_tables(p.ring()) && p.inSingleBlock())
+    return 4;
+  return 0;
+}
+
 bool GroebnerStrategy::shorterElimination(const MonomialSet& divisors, wlen_type el,
                                            MonomialSet::deg_type deg) const {
   return std::find_if(divisors.expBegin(),divisors.expEnd(),
@@ -673,14 +693,30 @@ void GroebnerStrategy::symmGB_F2(){
     const int selection_size = 1000;
     const double pair_size_factor = 2.0;
 
+    GroebnerBudget::Run run(budget);
+    // private rings of the worker threads are set up once (on demand)
+    CDDForkJoin forks(ring());
     while(pairs.queue.size() > 0) {
+      if PBORI_UNLIKELY(budget.exhausted(ring()) ||
+                        budget.exceeds(pairs.queue.top().sugar)) {
+        log("Budget exhausted\n");
+        return;
+      }
+
       std::vector<Polynomial> next = 
-	small_next_degree_spolys(*this, pair_size_factor, selection_size);
+	small_next_degree_spolys(*this, pair_size_factor, selection_size, forks);
       std::vector<Polynomial> res = 
 	parallel_reduce(next, *this, steps(next.size()), max_growth);
 
-      for_each(res.rbegin(), std::find(res.rbegin(), res.rend(), 1),
-	       *this, &self::addAsYouWish);
+      std::vector<Polynomial>::reverse_iterator one =
+        std::find(res.rbegin(), res.rend(), 1);
+      for_each(res.rbegin(), one, *this, &self::addAsYouWish);
+
+      // the system is inconsistent, nothing more to do
+      if PBORI_UNLIKELY(one != res.rend()) {
+        addAsYouWish(*one);
+        return;
+      }
     }
 }
 
@@ -715,7 +751,7 @@ std::vector<Polynomial> GroebnerStrategy::noroStep(const std::vector<Polynomial>
     for(std::size_t i=0;i<orig_system.size();i++){
         Polynomial p=orig_system[i];
         if PBORI_LIKELY(!(p.isZero())){
-            p=ll_red_nf(p,generators.llReductor);
+            p=generators.llNormalForm(p);
             if PBORI_LIKELY(!(p.isZero())){
                 p=generators.reducedNormalForm(p);
                 if PBORI_LIKELY(!(p.isZero())){
@@ -740,11 +776,16 @@ std::vector<Polynomial> GroebnerStrategy::noroStep(const std::vector<Polynomial>
         std::cout<<"ROWS:"<<rows<<"COLUMNS:"<<cols<<std::endl;
     }
     mzd_t* mat=mzd_init(rows,cols);
-    std::vector<Exponent> terms_as_exp(terms.size());
-    std::copy(terms.expBegin(),terms.expEnd(),terms_as_exp.begin());
+    std::vector<Exponent> terms_as_exp_lex(terms.size());
+    std::copy(terms.expBegin(),terms.expEnd(),terms_as_exp_lex.begin());
 
-    std::sort(terms_as_exp.begin(),terms_as_exp.end(),
-              ExpGreater(polys[0].ring()));
+    //iteration is lex ordered, so no comparison sort is needed
+    std::vector<std::size_t> lex_pos=
+        lex_sorted_to_ring_order(terms_as_exp_lex,polys[0].ring());
+    std::vector<Exponent> terms_as_exp(terms.size());
+    for (std::size_t i=0;i<lex_pos.size();i++){
+        terms_as_exp[i]=terms_as_exp_lex[lex_pos[i]];
+    }
 
 
     from_term_map_type from_term_map;
@@ -802,6 +843,16 @@ GroebnerStrategy::faugereStepDense(const std::vector<Polynomial>& orig_system){
 
   if (orig_system.empty())
     return orig_system;
+
+  GroebnerBudget::Run run(budget);
+  if PBORI_UNLIKELY(budget.exhausted(ring())) {
+    log("Budget exhausted\n");
+    for (std::vector<Polynomial>::const_iterator start(orig_system.begin());
+         start != orig_system.end(); ++start)
+      if (!start->isZero())
+        addGeneratorDelayed(*start);
+    return std::vector<Polynomial>();
+  }
   
   std::vector<Polynomial> polys;
   MonomialSet terms(orig_system[0].ring()), leads_from_strat(terms);
@@ -815,4 +866,241 @@ GroebnerStrategy::faugereStepDense(const std::vector<Polynomial>& orig_system){
   return polys;
 }
 
+static void write_exponent(std::ostream& output, const Exponent& exp) {
+  output << exp.size();
+  for (Exponent::const_iterator start(exp.begin()); start != exp.end(); ++start)
+    output << ' ' << *start;
+}
+
+static void write_polynomial(std::ostream& output, const Polynomial& poly) {
+  output << poly.length();
+  for (Polynomial::exp_iterator start(poly.expBegin()), finish(poly.expEnd());
+       start != finish; ++start) {
+    output << ' ';
+    write_exponent(output, *start);
+  }
+}
+
+template <class ValueType>
+static ValueType read_value(std::istream& input) {
+  ValueType result;
+  if (!(input >> result))
+    throw std::runtime_error("Invalid data for GroebnerStrategy");
+  return result;
+}
+
+static void read_keyword(std::istream& input, const char* keyword) {
+  if (read_value<std::string>(input) != keyword)
+    throw std::runtime_error("Invalid data for GroebnerStrategy");
+}
+
+/// Read a string written as its length, a blank and its characters
+static std::string read_string(std::istream& input) {
+  std::string result(read_value<std::size_t>(input), ' ');
+  if ((input.get() != ' ') ||
+      !input.read(&result[0], (std::streamsize)result.size()))
+    throw std::runtime_error("Invalid data for GroebnerStrategy");
+  return result;
+}
+
+static Exponent read_exponent(std::istream& input) {
+  Exponent result;
+  for (std::size_t deg = read_value<std::size_t>(input); deg > 0; --deg)
+    result.push_back(read_value<idx_type>(input));
+  return result;
+}
+
+static Polynomial read_polynomial(std::istream& input,
+                                  const BoolePolyRing& ring) {
+  std::vector<Exponent> terms(read_value<std::size_t>(input));
+  for (std::vector<Exponent>::iterator start(terms.begin());
+       start != terms.end(); ++start)
+    *start = read_exponent(input);
+  return add_up_exponents(terms, Polynomial(ring));
+}
+
+static Pair read_index_pair(std::istream& input, int type,
+                            const PolyEntryVector& generators) {
+  const int idx = read_value<int>(input);
+  const int other = read_value<int>(input);
+  if (((type != IJ_PAIR) && (type != VARIABLE_PAIR)) ||
+      (idx < 0) || ((std::size_t)idx >= generators.size()) ||
+      ((type == IJ_PAIR) &&
+       ((other < 0) || ((std::size_t)other >= generators.size()))))
+    throw std::runtime_error("Invalid data for GroebnerStrategy");
+
+  return (type == IJ_PAIR? Pair(idx, other, generators):
+          Pair(idx, other, generators, VARIABLE_PAIR));
+}
+
+void GroebnerStrategy::save(std::ostream& output) const {
+
+  output << "BRiAl-GroebnerStrategy " << save_format_version << '\n';
+
+  output << "ring " << ring().nVariables() << ' ' 
+         << ring().ordering().getOrderCode() << ' '
+         << (ring().ordering().blockEnd() - ring().ordering().blockBegin());
+  for (COrderingBase::block_iterator start(ring().ordering().blockBegin());
+       start != ring().ordering().blockEnd(); ++start)
+    output << ' ' << *start;
+
+  output << "\noptions " << optRedTailInLastBlock << ' ' << optLazy << ' '
+         << optDrawMatrices << ' ' << optModifiedLinearAlgebra << ' '
+         << optDelayNonMinimals << ' ' << enabledLog << ' ' << optExchange
+         << ' ' << optHFE << ' ' << optStepBounded << ' ' << optAllowRecursion
+         << ' ' << optLinearAlgebraInLastBlock << ' ' << reduceByTailReduced
+         << ' ' << optBatchTailReduce << ' ' << reductionLanes
+         << ' ' << optBlockTables
+         << ' ' << generators.optBrutalReductions << ' ' << generators.optLL
+         << ' ' << generators.optRedTailDegGrowth << ' '
+         << generators.optRedTail << ' ' << generators.optLLTable << ' '
+         << generators.llForkDepth << ' ' << generators.reducibleUntil
+         << "\nprefix " << matrixPrefix.size() << ' ' << matrixPrefix;
+
+  output << "\ncriteria " << chainCriterions << ' ' << variableChainCriterions
+         << ' ' << easyProductCriterions << ' ' << extendedProductCriterions;
+
+  output << "\ncounters " << reductionSteps << ' ' << normalForms << ' '
+         << currentDegree << ' ' << averageLength;
+
+  output << "\ngenerators " << generators.size();
+  for (ReductionStrategy::const_iterator start(generators.begin());
+       start != generators.end(); ++start) {
+    output << '\n' << start->vPairCalculated.size();
+    for (std::set<idx_type>::const_iterator iter(start->vPairCalculated.begin());
+         iter != start->vPairCalculated.end(); ++iter)
+      output << ' ' << *iter;
+    output << ' ';
+    write_polynomial(output, start->p);
+  }
+
+  PairManager::queue_type queue(pairs.queue);
+  output << "\npairs " << queue.size();
+  for (; !queue.empty(); queue.pop()) {
+    const Pair& pair = queue.top();
+    output << '\n' << pair.getType() << ' ' << pair.sugar << ' ' << pair.wlen
+           << ' ';
+    write_exponent(output, pair.lm);
+    output << ' ';
+    switch (pair.getType()) {
+    case IJ_PAIR:
+      output << pair.ijPair().i << ' ' << pair.ijPair().j;
+      break;
+    case VARIABLE_PAIR:
+      output << pair.variablePair().i << ' ' << pair.variablePair().v;
+      break;
+    default:
+      write_polynomial(output, pair.delayedPair().p);
+    }
+  }
+
+  output << "\nstatus " << generators.size();
+  for (std::size_t j = 1; j < generators.size(); ++j) {
+    output << '\n';
+    for (std::size_t i = 0; i < j; ++i)
+      output << pairs.status.hasTRep(i, j);
+  }
+  output << std::endl;
+}
+
+void GroebnerStrategy::load(std::istream& input) {
+
+  if (!generators.empty() || !pairs.pairSetEmpty())
+    throw std::runtime_error("GroebnerStrategy must be empty for loading");
+
+  read_keyword(input, "BRiAl-GroebnerStrategy");
+  if (read_value<int>(input) != save_format_version)
+    throw std::runtime_error("Unsupported version of saved GroebnerStrategy");
+
+  read_keyword(input, "ring");
+  bool compatible = (read_value<std::size_t>(input) == ring().nVariables()) &&
+    (read_value<int>(input) == ring().ordering().getOrderCode()) &&
+    (read_value<long>(input) ==
+     (ring().ordering().blockEnd() - ring().ordering().blockBegin()));
+  for (COrderingBase::block_iterator start(ring().ordering().blockBegin());
+       compatible && (start != ring().ordering().blockEnd()); ++start)
+    compatible = (read_value<idx_type>(input) == *start);
+  if (!compatible)
+    throw std::runtime_error("Saved GroebnerStrategy belongs to another ring");
+
+  read_keyword(input, "options");
+  optRedTailInLastBlock = read_value<bool>(input);
+  optLazy = read_value<bool>(input);
+  optDrawMatrices = read_value<bool>(input);
+  optModifiedLinearAlgebra = read_value<bool>(input);
+  optDelayNonMinimals = read_value<bool>(input);
+  enabledLog = read_value<bool>(input);
+  optExchange = read_value<bool>(input);
+  optHFE = read_value<bool>(input);
+  optStepBounded = read_value<bool>(input);
+  optAllowRecursion = read_value<bool>(input);
+  optLinearAlgebraInLastBlock = read_value<bool>(input);
+  reduceByTailReduced = read_value<bool>(input);
+  optBatchTailReduce = read_value<bool>(input);
+  reductionLanes = read_value<unsigned>(input);
+  optBlockTables = read_value<bool>(input);
+  generators.optBrutalReductions = read_value<bool>(input);
+  generators.optLL = read_value<bool>(input);
+  generators.optRedTailDegGrowth = read_value<bool>(input);
+  generators.optRedTail = read_value<bool>(input);
+  generators.optLLTable = read_value<bool>(input);
+  generators.llForkDepth = read_value<unsigned>(input);
+  generators.reducibleUntil = read_value<idx_type>(input);
+
+  read_keyword(input, "prefix");
+  matrixPrefix = read_string(input);
+
+  read_keyword(input, "criteria");
+  chainCriterions = read_value<int>(input);
+  variableChainCriterions = read_value<int>(input);
+  easyProductCriterions = read_value<int>(input);
+  extendedProductCriterions = read_value<int>(input);
+
+  read_keyword(input, "counters");
+  reductionSteps = read_value<unsigned int>(input);
+  normalForms = read_value<int>(input);
+  currentDegree = read_value<int>(input);
+  averageLength = read_value<int>(input);
+
+  read_keyword(input, "generators");
+  const std::size_t nlen = read_value<std::size_t>(input);
+  for (std::size_t idx = 0; idx < nlen; ++idx) {
+    std::set<idx_type> calculated;
+    for (std::size_t nvars = read_value<std::size_t>(input); nvars > 0; --nvars)
+      calculated.insert(read_value<idx_type>(input));
+
+    generators.addGenerator(PolyEntry(read_polynomial(input, ring())));
+    generators(idx).vPairCalculated.swap(calculated);
+  }
+
+  read_keyword(input, "pairs");
+  for (std::size_t npairs = read_value<std::size_t>(input); npairs > 0;
+       --npairs) {
+    const int type = read_value<int>(input);
+    const deg_type sugar = read_value<deg_type>(input);
+    const wlen_type wlen = read_value<wlen_type>(input);
+    const Exponent lm = read_exponent(input);
+
+    Pair pair = (type == DELAYED_PAIR? Pair(read_polynomial(input, ring())):
+                 read_index_pair(input, type, generators));
+    pair.sugar = sugar;
+    pair.wlen = wlen;
+    pair.lm = lm;
+    pairs.queue.push(pair);
+  }
+
+  read_keyword(input, "status");
+  if (read_value<std::size_t>(input) != nlen)
+    throw std::runtime_error("Invalid data for GroebnerStrategy");
+  pairs.status = PairStatusSet(nlen);
+  for (std::size_t j = 1; j < nlen; ++j) {
+    const std::string row = read_value<std::string>(input);
+    if (row.size() != j)
+      throw std::runtime_error("Invalid data for GroebnerStrategy");
+    for (std::size_t i = 0; i < j; ++i)
+      if (row[i] == '1')
+        pairs.status.setToHasTRep(i, j);
+  }
+}
+
 END_NAMESPACE_PBORIGB
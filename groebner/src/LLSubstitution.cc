@@ -0,0 +1,85 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file LLSubstitution.cc
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c LLSubstitution.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+// include basic definitions
+#include <polybori/groebner/LLSubstitution.h>
+
+BEGIN_NAMESPACE_PBORIGB
+
+LLSubstitution::LLSubstitution(const MonomialSet& reductors):
+  m_reductors(reductors), m_replacements(), m_eliminated(), m_count(0) {
+
+  // eliminated variables form the then-chain, replacements the else-branches
+  navigator navi = reductors.navigation();
+  while (!navi.isConstant()) {
+    idx_type idx = *navi;
+    if (idx >= (idx_type)m_replacements.size()) {
+      m_replacements.resize(idx + 1, reductors.ring().zero());
+      m_eliminated.resize(idx + 1, false);
+    }
+    m_replacements[idx] = MonomialSet(reductors.ring(), navi.elseBranch());
+    m_eliminated[idx] = true;
+    ++m_count;
+    navi.incrementThen();
+  }
+}
+
+Polynomial
+LLSubstitution::operator()(const Polynomial& p) const {
+
+  return substitute(cache_mgr_type(p.ring()), p.navigation());
+}
+
+bool
+LLSubstitution::cached(const Polynomial& p) const {
+
+  cache_mgr_type cache_mgr(p.ring());
+  navigator found = cache_mgr.find(p.navigation(), m_reductors.navigation());
+
+  if (!found.isValid())
+    return false;
+
+  // lookups revive dead results, wrapping them releases them properly
+  cache_mgr.generate(found);
+  return true;
+}
+
+MonomialSet
+LLSubstitution::substitute(const cache_mgr_type& cache_mgr,
+                           navigator navi) const {
+
+  // no eliminated variable below top index
+  if (navi.isConstant() || (*navi >= (idx_type)m_replacements.size()))
+    return cache_mgr.generate(navi);
+
+  navigator cached = cache_mgr.find(navi, m_reductors.navigation());
+  if (cached.isValid())
+    return cache_mgr.generate(cached);
+
+  idx_type idx = *navi;
+  MonomialSet then_branch = substitute(cache_mgr, navi.thenBranch());
+  MonomialSet else_branch = substitute(cache_mgr, navi.elseBranch());
+
+  const MonomialSet* value = replacement(idx);
+  MonomialSet result = (value == NULL?
+                        MonomialSet(idx, then_branch, else_branch):
+                        (Polynomial(else_branch) +
+                         Polynomial(then_branch) * Polynomial(*value)).set());
+
+  cache_mgr.insert(navi, m_reductors.navigation(), result.navigation());
+  return result;
+}
+
+END_NAMESPACE_PBORIGB
@@ -17,7 +17,7 @@
 // include basic definitions
 
 #include <polybori/groebner/MatrixMonomialOrderTables.h>
-#include <polybori/groebner/ExpGreater.h>
+#include <polybori/groebner/ExpOrderDispatch.h>
 
 #include <algorithm>
 
@@ -28,21 +28,18 @@ MatrixMonomialOrderTables::setup_order_tables(){
     int n=terms.size();
     terms_as_exp.resize(n);
     terms_as_exp_lex.resize(n);
-    std::copy(terms.expBegin(),terms.expEnd(),terms_as_exp.begin());
-    terms_as_exp_lex=terms_as_exp;
-    std::sort(terms_as_exp.begin(),terms_as_exp.end(),
-	      ExpGreater(terms.ring()));
+    std::copy(terms.expBegin(),terms.expEnd(),terms_as_exp_lex.begin());
+    //iteration is lex ordered, so no comparison sort is needed
+    std::vector<std::size_t> lex_pos=
+        lex_sorted_to_ring_order(terms_as_exp_lex,terms.ring());
     ring_order2lex.resize(n);
     lex_order2ring.resize(n);
     int i;
     for (i=0;i<n;i++){
+        terms_as_exp[i]=terms_as_exp_lex[lex_pos[i]];
         from_term_map[terms_as_exp[i]]=i;
-        //to_term_map[i]=Monomial(terms_as_exp[i]);
-    }
-    for (i=0;i<n;i++){
-        int ring_pos=from_term_map[terms_as_exp_lex[i]];
-        ring_order2lex[ring_pos]=i;
-        lex_order2ring[i]=ring_pos;
+        ring_order2lex[i]=lex_pos[i];
+        lex_order2ring[lex_pos[i]]=i;
         //to_term_map[i]=Monomial(terms_as_exp[i]);
     }
 }
@@ -16,8 +16,6 @@
 
 // include basic definitions
 #include <polybori/groebner/ReductionStrategy.h>
-#include <polybori/groebner/LessWeightedLengthInStrat.h>
-#include <polybori/groebner/LessWeightedLengthInStratModified.h>
 #include <polybori/groebner/nf.h>
 #include <polybori/groebner/red_tail.h>
 
@@ -39,6 +37,7 @@ void ReductionStrategy::setupSetsForElement(const PolyEntry& entry) {
   leadingTerms11.update(entry);
   
   monomials.update(entry);
+  binomials.update(entry);
   
 #ifdef LL_RED_FOR_GROEBNER
   if (optLL) {
@@ -52,16 +51,22 @@ void ReductionStrategy::setupSetsForElement(const PolyEntry& entry) {
 int
 ReductionStrategy::select_short_by_terms(const MonomialSet& terms) const {
   MonomialSet ms(leadingTerms.intersect(terms));
-  int res = minimum(ms.begin(), ms.end(), LessWeightedLengthInStrat(*this));
+  int res = minimum(ms, &PolyEntryIndices::weightedLength);
 
-  if (res == -1 || (*this)[res].weightedLength<=2)
+  if (res == -1 || indices().weightedLength(res)<=2)
     return res;
 
   return -1;
 }
- 
 
-typedef LessWeightedLengthInStratModified StratComparerForSelect;
+int
+ReductionStrategy::select_short(const Monomial& m) const {
+  int res = m_select_short.find(m, indices().revision());
+  if (res != ReducerSelectionCache::not_cached)
+    return res;
+
+  return m_select_short.insert(m, select_short_by_terms(m.divisors()));
+}
 
 
 int
@@ -79,8 +84,13 @@ ReductionStrategy::select1(const Polynomial& p) const {
 
 int
 ReductionStrategy::select1(const Monomial& m) const {
+  int res = m_select1.find(m, indices().revision());
+  if (res != ReducerSelectionCache::not_cached)
+    return res;
+
   MonomialSet ms(leadingTerms.divisorsOf(m));
-  return minimum(ms.expBegin(), ms.expEnd(), StratComparerForSelect(*this));
+  return m_select1.insert(m, minimum(ms,
+                                     &PolyEntryIndices::literalWeightedLength));
 }
 
 Polynomial
@@ -92,6 +102,14 @@ ReductionStrategy::reducedNormalForm(const Polynomial& p) const {
 Polynomial
 ReductionStrategy::headNormalForm(const Polynomial& p) const {
   if PBORI_UNLIKELY(p.isZero()) return p;
+
+  if (binomials.dominant(size())) {
+    Polynomial reduced = binomial_nf(*this, p);
+    if (reduced.isZero()) return reduced;
+    return (p.ring().ordering().isDegreeOrder()?
+            nf3_degree_order(*this, reduced, reduced.lead()):
+            nf3(*this, reduced, reduced.lead()));
+  }
     
   return (p.ring().ordering().isDegreeOrder()?
 	  nf3_degree_order(*this, p, p.lead()): nf3(*this, p, p.lead()));
@@ -108,7 +126,7 @@ void ReductionStrategy::llReduceAll() {
 void ReductionStrategy::llReduce(const PolyEntry& entry, const Exponent& ll_e){
 
   if ((entry.minimal) && (ll_e.GCD(entry.tailVariables).deg() > 0)) {
-    Polynomial tail = ll_red_nf(entry.tail, llReductor);
+    Polynomial tail = llNormalForm(entry.tail);
     if (tail != entry.tail) {
       operator()(entry) = tail + entry.lead;
       monomials.update(entry);
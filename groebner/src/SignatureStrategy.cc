@@ -0,0 +1,449 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file SignatureStrategy.cc
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file includes the definition of the class @c SignatureStrategy.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+// include definitions
+#include <polybori/groebner/SignatureStrategy.h>
+#include <polybori/groebner/ReductionStrategy.h>
+#include <polybori/groebner/red_tail.h>
+#include <polybori/groebner/RedTailNth.h>
+#include <polybori/groebner/minimal_elements.h>
+
+#include <algorithm>
+
+BEGIN_NAMESPACE_PBORIGB
+
+// F2[x]-product of terms, i.e. squares are kept
+template <class LhsType, class RhsType>
+static SignatureTermOrder::term_type
+term_product(const LhsType& lhs, const RhsType& rhs) {
+  SignatureTermOrder::term_type result(lhs.size() + rhs.size());
+  std::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), result.begin());
+  return result;
+}
+
+// Exponent of a square-free term
+static Exponent
+term_exponent(const SignatureTermOrder::term_type& term) {
+  Exponent result;
+  result.reserve(term.size());
+  for (SignatureTermOrder::const_iterator start(term.begin());
+       start != term.end(); ++start)
+    result.push_back(*start);
+  return result;
+}
+
+// Product of coprime exponents, returns false otherwise
+static bool
+squarefree_product(const Exponent& lhs, const Exponent& rhs, Exponent& result) {
+  result = lhs.multiply(rhs);
+  return (result.size() == lhs.size() + rhs.size());
+}
+
+
+SignatureTermOrder::SignatureTermOrder(const BoolePolyRing& ring):
+  m_blocks(), m_degree(true), m_ascending(false) {
+
+  switch(ring.ordering().getOrderCode()) {
+  case COrderEnums::lp:
+    m_degree = false;
+    break;
+  case COrderEnums::dp_asc:
+  case COrderEnums::block_dp_asc:
+    m_ascending = true;
+    break;
+  default:
+    break;
+  }
+
+  if (ring.ordering().isBlockOrder())
+    m_blocks.assign(ring.ordering().blockBegin(), ring.ordering().blockEnd());
+
+  if (m_blocks.empty() || (m_blocks.back() != CTypes::max_index()))
+    m_blocks.push_back(CTypes::max_index());
+}
+
+SignatureTermOrder::comp_type
+SignatureTermOrder::compare(const_iterator lhs_start, const_iterator lhs_finish,
+                            const_iterator rhs_start,
+                            const_iterator rhs_finish) const {
+
+  std::vector<idx_type>::const_iterator block(m_blocks.begin());
+  while (true) {
+    const_iterator lhs_end = std::lower_bound(lhs_start, lhs_finish, *block);
+    const_iterator rhs_end = std::lower_bound(rhs_start, rhs_finish, *block);
+    if (++block == m_blocks.end())
+      lhs_end = lhs_finish, rhs_end = rhs_finish;
+
+    if (m_degree && (lhs_end - lhs_start != rhs_end - rhs_start))
+      return (lhs_end - lhs_start > rhs_end - rhs_start?
+              CTypes::greater_than: CTypes::less_than);
+
+    // lexicographical (descending variables) or reverse lexicographical
+    while ((lhs_start != lhs_end) && (rhs_start != rhs_end)) {
+      if (*lhs_start != *rhs_start)
+        return ((*lhs_start < *rhs_start) != m_ascending?
+                CTypes::greater_than: CTypes::less_than);
+      ++lhs_start, ++rhs_start;
+    }
+    if (lhs_start != lhs_end)
+      return CTypes::greater_than;
+    if (rhs_start != rhs_end)
+      return CTypes::less_than;
+
+    if (block == m_blocks.end())
+      return CTypes::equality;
+
+    lhs_start = lhs_end;
+    rhs_start = rhs_end;
+  }
+}
+
+
+bool
+SignatureStrategy::pair_greater::operator()(const pair_type& lhs,
+                                            const pair_type& rhs) const {
+  CTypes::comp_type result = m_order.compare(lhs.sig, rhs.sig);
+  if (result == CTypes::equality)
+    result = m_order.compare(lhs.lead, rhs.lead);
+  if (result == CTypes::equality)
+    return (lhs.element + 1 > rhs.element + 1);
+
+  return (result == CTypes::greater_than);
+}
+
+
+SignatureStrategy::SignatureStrategy(const BoolePolyRing& ring):
+  enabledLog(false), reductionSteps(0), zeroReductions(0),
+  syzygyCriterions(0), rewriteCriterions(0),
+  m_ring(ring), m_order(ring), m_elements(), m_leads(ring),
+  m_lead2owners(), m_owners(), m_reductors(new ReductionStrategy(ring)), m_level(0),
+  m_input(ring),
+  m_syzygies(ring), m_signatures(ring), m_sig2element(),
+  m_pairs(pair_greater(m_order)), m_containsOne(false) {}
+
+void
+SignatureStrategy::addGenerator(const Polynomial& poly) {
+
+  PBORI_ASSERT(poly.ring().id() == ring().id());
+  if (m_containsOne || poly.isZero())
+    return;
+
+  // Signatures of the previous levels are not needed anymore, so use the
+  // reduced basis from now on
+  if (!m_elements.empty()) {
+    std::vector<Polynomial> basis = minimalizeAndTailReduce();
+    m_elements.clear();
+    m_leads = MonomialSet(ring());
+    m_lead2owners = LeadIndexTable<Exponent, LeadExpHasher>();
+    m_owners.clear();
+    m_reductors.reset(new ReductionStrategy(ring()));
+    for (std::vector<Polynomial>::const_iterator start(basis.begin());
+         start != basis.end(); ++start) {
+      m_elements.push_back(element_type(*start, Exponent(), 0));
+      registerElement(m_elements.size() - 1);
+      m_reductors->addGenerator(PolyEntry(*start));
+    }
+  }
+
+  ++m_level;
+  m_input = poly;
+
+  // Leading terms of the previous basis are (Koszul) syzygy signatures
+  m_syzygies = m_leads;
+  m_signatures = MonomialSet(ring());
+  m_sig2element = LeadIndexTable<Exponent, LeadExpHasher>();
+  m_pairs = queue_type(pair_greater(m_order));
+
+  const Exponent lead = poly.leadExp();
+  m_pairs.push(pair_type(Exponent(), Exponent(), npos,
+                         term_type(lead.begin(), lead.end())));
+  bool processed = false;
+  Exponent last;
+
+  while (!m_pairs.empty() && !m_containsOne) {
+    pair_type pair(m_pairs.top());
+    m_pairs.pop();
+
+    if (processed && (pair.sig == last)) {
+      ++rewriteCriterions;
+      continue;
+    }
+    if (isSyzygy(pair.sig)) {
+      ++syzygyCriterions;
+      continue;
+    }
+    if (isRewritable(pair)) {
+      ++rewriteCriterions;
+      continue;
+    }
+    processed = true;
+    last = pair.sig;
+
+    Polynomial reduced = (pair.element == npos? m_input:
+                          m_elements[pair.element].p *
+                          Monomial(pair.multiplier, ring()));
+
+    bool singular = false;
+    reduced = regularReduce(reduced, pair.sig, singular);
+
+    if (reduced.isZero()) {
+      log("zero reduction");
+      ++zeroReductions;
+      addSyzygy(pair.sig);
+    }
+    else if (!singular)
+      addElement(reduced, pair.sig);
+  }
+}
+
+bool
+SignatureStrategy::isSyzygy(const Exponent& sig) const {
+  return !m_syzygies.divisorsOf(sig).isZero();
+}
+
+bool
+SignatureStrategy::isRewritable(const pair_type& pair) const {
+
+  MonomialSet divisors = m_signatures.divisorsOf(pair.sig);
+  for (MonomialSet::exp_iterator start(divisors.expBegin()),
+         finish(divisors.expEnd()); start != finish; ++start) {
+
+    const element_type& elt = m_elements[m_sig2element.find(*start)];
+    if (m_order.compare(term_product(pair.sig.divide(elt.sig), elt.leadExp),
+                        pair.lead) == CTypes::less_than)
+      return true;
+  }
+  return false;
+}
+
+Polynomial
+SignatureStrategy::regularReduce(Polynomial poly, const Exponent& sig,
+                                 bool& singular) {
+
+  while (!poly.isZero()) {
+    // Elements of previous levels reduce without signature restrictions
+    if (!m_reductors->empty())
+      poly = m_reductors->headNormalForm(poly);
+
+    if (poly.isOne()) {
+      m_containsOne = true;
+      return poly;
+    }
+    if (poly.isZero())
+      return poly;
+
+    Exponent lead = poly.leadExp();
+    MonomialSet divisors = m_leads.divisorsOf(lead);
+
+    size_type best = npos;
+    Exponent best_factor;
+    singular = false;
+
+    for (MonomialSet::exp_iterator start(divisors.expBegin()),
+           finish(divisors.expEnd()); start != finish; ++start) {
+
+      Exponent factor = lead.divide(*start);
+      const std::vector<size_type>& owners =
+        m_owners[m_lead2owners.find(*start)];
+
+      for (std::vector<size_type>::const_iterator iter(owners.begin());
+           iter != owners.end(); ++iter) {
+        const element_type& elt = m_elements[*iter];
+        PBORI_ASSERT(elt.level == m_level);
+        CTypes::comp_type cmp =
+          m_order.compare(term_product(factor, elt.sig),
+                          term_type(sig.begin(), sig.end()));
+        if (cmp == CTypes::equality)
+          singular = true;
+        if (cmp != CTypes::less_than)
+          continue;
+        if ((best == npos) || (elt.length < m_elements[best].length)) {
+          best = *iter;
+          best_factor = factor;
+        }
+      }
+    }
+
+    if (best == npos)
+      return poly;
+
+    singular = false;
+    ++reductionSteps;
+    poly += m_elements[best].p * Monomial(best_factor, ring());
+  }
+  return poly;
+}
+
+void
+SignatureStrategy::addSyzygy(const Exponent& sig) {
+  m_syzygies = m_syzygies.unite(Monomial(sig, ring()).set());
+}
+
+void
+SignatureStrategy::addPair(const Exponent& sig, const Exponent& factor,
+                           size_type idx, const term_type& lead) {
+  if (isSyzygy(sig))
+    ++syzygyCriterions;
+  else
+    m_pairs.push(pair_type(sig, factor, idx, lead));
+}
+
+void
+SignatureStrategy::addElement(const Polynomial& poly, const Exponent& sig) {
+
+  if (poly.isOne()) {
+    m_containsOne = true;
+    return;
+  }
+
+  const size_type idx = m_elements.size();
+  m_elements.push_back(element_type(poly, sig, m_level));
+  const element_type& elt = m_elements.back();
+
+  // J-pairs with the previous elements
+  Exponent product;
+  for (size_type other = 0; other < idx; ++other) {
+    const element_type& rhs = m_elements[other];
+
+    Exponent lcm = elt.leadExp.LCM(rhs.leadExp);
+    Exponent factor = lcm.divide(elt.leadExp);
+    bool regular = squarefree_product(factor, elt.sig, product);
+
+    if (rhs.level == m_level) {
+      // Principal syzygy of both elements
+      term_type lhs_syz = term_product(elt.leadExp, rhs.sig);
+      term_type rhs_syz = term_product(rhs.leadExp, elt.sig);
+      CTypes::comp_type cmp = m_order.compare(lhs_syz, rhs_syz);
+      const term_type& syz = (cmp == CTypes::less_than? rhs_syz: lhs_syz);
+      if ((cmp != CTypes::equality) &&
+          (std::adjacent_find(syz.begin(), syz.end()) == syz.end()))
+        addSyzygy(term_exponent(syz));
+
+      // J-pair is the multiple of larger signature
+      Exponent rhs_factor = lcm.divide(rhs.leadExp);
+      cmp = m_order.compare(term_product(factor, elt.sig),
+                            term_product(rhs_factor, rhs.sig));
+      if (cmp == CTypes::equality)
+        continue;
+
+      if (cmp == CTypes::less_than) {
+        if (squarefree_product(rhs_factor, rhs.sig, product))
+          addPair(product, rhs_factor, other,
+                  term_product(rhs_factor, rhs.leadExp));
+        else
+          ++syzygyCriterions;
+        continue;
+      }
+    }
+
+    if (regular)
+      addPair(product, factor, idx, term_product(factor, elt.leadExp));
+    else
+      ++syzygyCriterions;
+  }
+
+  // Boolean syzygy poly * (poly + 1) = 0, and pairs with field equations
+  if (squarefree_product(elt.leadExp, elt.sig, product))
+    addSyzygy(product);
+
+  for (Exponent::const_iterator start(elt.leadExp.begin());
+       start != elt.leadExp.end(); ++start) {
+    Exponent var;
+    var.push_back(*start);
+    if (squarefree_product(var, elt.sig, product))
+      addPair(product, var, idx, term_product(var, elt.leadExp));
+  }
+
+  registerElement(idx);
+  m_signatures = m_signatures.unite(Monomial(sig, ring()).set());
+  m_sig2element.insert(sig, idx);
+}
+
+void
+SignatureStrategy::registerElement(size_type idx) {
+  const element_type& elt = m_elements[idx];
+
+  idx_type owner = m_lead2owners.find(elt.leadExp);
+  if (owner < 0) {
+    owner = m_owners.size();
+    m_owners.push_back(std::vector<size_type>());
+    m_lead2owners.insert(elt.leadExp, owner);
+    m_leads = m_leads.unite(Monomial(elt.leadExp, ring()).set());
+  }
+  m_owners[owner].push_back(idx);
+}
+
+const SignatureStrategy::element_type&
+SignatureStrategy::minimalElement(const Exponent& lead) const {
+  const std::vector<size_type>& owners = m_owners[m_lead2owners.find(lead)];
+  PBORI_ASSERT(!owners.empty());
+
+  size_type best = owners.front();
+  for (std::vector<size_type>::const_iterator start(owners.begin());
+       start != owners.end(); ++start)
+    if (m_elements[*start].length < m_elements[best].length)
+      best = *start;
+
+  return m_elements[best];
+}
+
+std::vector<Polynomial>
+SignatureStrategy::allGenerators() const {
+  if (m_containsOne)
+    return std::vector<Polynomial>(1, Polynomial(true, ring()));
+
+  std::vector<Polynomial> result;
+  result.reserve(m_elements.size());
+  for (std::vector<element_type>::const_iterator start(m_elements.begin());
+       start != m_elements.end(); ++start)
+    result.push_back(start->p);
+  return result;
+}
+
+std::vector<Polynomial>
+SignatureStrategy::minimalize() const {
+  if (m_containsOne)
+    return std::vector<Polynomial>(1, Polynomial(true, ring()));
+
+  MonomialSet minelts = minimal_elements(m_leads);
+  std::vector<Polynomial> result;
+  result.reserve(minelts.size());
+  for (MonomialSet::exp_iterator start(minelts.expBegin()),
+         finish(minelts.expEnd()); start != finish; ++start)
+    result.push_back(minimalElement(*start).p);
+  return result;
+}
+
+std::vector<Polynomial>
+SignatureStrategy::minimalizeAndTailReduce() const {
+  if (m_containsOne)
+    return std::vector<Polynomial>(1, Polynomial(true, ring()));
+
+  std::vector<Polynomial> minimal = minimalize();
+
+  ReductionStrategy generators(ring());
+  generators.optRedTailDegGrowth = true;
+  for (std::vector<Polynomial>::const_iterator start(minimal.begin());
+       start != minimal.end(); ++start)
+    generators.addGenerator(PolyEntry(*start));
+
+  MonomialSet minelts = minimal_elements(m_leads);
+  std::vector<Polynomial> result(minelts.size(), ring());
+  std::transform(minelts.rExpBegin(), minelts.rExpEnd(), result.rbegin(),
+                 RedTailNth(generators));
+  return result;
+}
+
+END_NAMESPACE_PBORIGB
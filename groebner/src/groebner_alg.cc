@@ -18,6 +18,7 @@
 
 #include <polybori/groebner/minimal_elements.h>
 #include <polybori/groebner/contained_variables.h>
+#include <polybori/groebner/DivisorBitMask.h>
 
 
 #include <polybori/groebner/groebner_alg.h>
@@ -113,8 +114,10 @@ MonomialSet mod_deg2_set(const CacheMgr& cache_mgr,
 
   MonomialSet result(cache_mgr.zero());
   if (a_index==v_index){
-    MonomialSet tmp = mod_var_set(cache_mgr.generate(a.thenBranch()), 
-                                  cache_mgr.generate(v.thenBranch()));
+    // diagram-based, since the filter changes with every call
+    typedef PBORI::CacheManager<CCacheTypes::mod_varset> var_cache_mgr_type;
+    MonomialSet tmp = mod_var_set(var_cache_mgr_type(cache_mgr.ring()),
+                                  a.thenBranch(), v.thenBranch());
     result=MonomialSet(a_index,
                        mod_deg2_set(cache_mgr, 
                                     tmp.navigation(), v.elseBranch()),
@@ -133,6 +136,10 @@ MonomialSet mod_deg2_set(const CacheMgr& cache_mgr,
 
 // Variant for MonomialSet
 MonomialSet mod_deg2_set(const MonomialSet& as, const MonomialSet &vs){
+  MonomialSet result(as.ring());
+  if (DivisorBitMask::modulo(as, vs, result))
+    return result;
+
   MonomialSet::navigator a=as.navigation();
   MonomialSet::navigator v=vs.navigation();
   typedef PBORI::CacheManager<CCacheTypes::mod_deg2_set>
@@ -231,11 +238,9 @@ Polynomial reduce_complete(const Polynomial& p, const Polynomial& reductor){
 }
 
 
-Polynomial reduce_complete(const Polynomial &p, const PolyEntry& reductor, wlen_type & len){
-  //cout<<"red complete"<<endl;
-  if (reductor.length==2){
-      return reduce_by_binom(p,reductor.p);
-  }
+/// Terms of p divisible by the leading term of reductor, divided by the latter
+/// (updates the length estimation len like @c reduce_complete)
+MonomialSet reduce_complete_factor(const Polynomial &p, const PolyEntry& reductor, wlen_type & len){
   MonomialSet rewriteable_terms_divided=p.diagram();
   Exponent::const_iterator it=reductor.leadExp.begin();
   Exponent::const_iterator end=reductor.leadExp.end();
@@ -243,18 +248,27 @@ Polynomial reduce_complete(const Polynomial &p, const PolyEntry& reductor, wlen_
     rewriteable_terms_divided=rewriteable_terms_divided.subset1(*it);
     it++;
   }
-  //divide_monomial_divisors_out(p.diagram(),reductor.lm);
-  //Polynomial res=p-reductor.lm*(Polynomial)rewriteable_terms_divided;
-  Polynomial factor_reductor=reductor.p;//tail;
   size_t factor_reductor_len=reductor.length;//factor_reductor.length();
   size_t rewriteable_terms_len=rewriteable_terms_divided.length();
   len=len+(factor_reductor_len-2)*rewriteable_terms_len;
+  return rewriteable_terms_divided;
+}
+
+Polynomial reduce_complete(const Polynomial &p, const PolyEntry& reductor, wlen_type & len){
+  //cout<<"red complete"<<endl;
+  if (reductor.length==2){
+      return reduce_by_binom(p,reductor.p);
+  }
+  MonomialSet rewriteable_terms_divided=reduce_complete_factor(p,reductor,len);
+  //divide_monomial_divisors_out(p.diagram(),reductor.lm);
+  //Polynomial res=p-reductor.lm*(Polynomial)rewriteable_terms_divided;
+  Polynomial factor_reductor=reductor.p;//tail;
   Polynomial product=
 #if 1
     factor_reductor*(Polynomial) rewriteable_terms_divided;
     //multiply_recursively2(factor_reductor,rewriteable_terms_divided);
 #else
-    multiply(factor_reductor,factor_reductor_len,rewriteable_terms_divided,rewriteable_terms_len);
+    multiply(factor_reductor,reductor.length,rewriteable_terms_divided,rewriteable_terms_divided.length());
 #endif
 
   /*if (factor_reductor_len<rewriteable_terms_len){
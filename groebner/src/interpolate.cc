@@ -13,6 +13,9 @@
 #include <polybori/groebner/randomset.h>
 #include <polybori/groebner/nf.h>
 #include <polybori/groebner/add_up.h>
+#include <polybori/groebner/IncrementalInterpolation.h>
+#include <polybori/groebner/LexOrderGreaterComparer.h>
+#include <stdexcept>
 
 BEGIN_NAMESPACE_PBORIGB
 
@@ -254,4 +257,113 @@ MonomialSet include_divisors(const MonomialSet& m){
     cache_mgr.insert(nav,result.navigation());
     return result;
 }
+
+/// Standard monomials of the vanishing ideal of points w.r.t. lex: the
+/// staircase of the projection V0 u V1 plus x times the one of V0 n V1
+/// (Cerlienco-Mureddu)
+MonomialSet variety_lex_standard_monomials(const MonomialSet& points){
+    MonomialSet::navigator nav=points.navigation();
+    if (nav.isConstant()) return points;
+    typedef PBORI::CacheManager<CCacheTypes::lex_standard_monomials>
+      cache_mgr_type;
+    cache_mgr_type cache_mgr(points.ring());
+    MonomialSet::navigator cached=cache_mgr.find(nav);
+    if (cached.isValid() ){
+      return cache_mgr.generate(cached);
+    }
+    MonomialSet p1=cache_mgr.generate(nav.thenBranch());
+    MonomialSet p0=cache_mgr.generate(nav.elseBranch());
+    MonomialSet result=MonomialSet(*nav,
+      variety_lex_standard_monomials(p1.intersect(p0)),
+      variety_lex_standard_monomials(p1.unite(p0)));
+    cache_mgr.insert(nav,result.navigation());
+    return result;
+}
+
+IncrementalInterpolation::IncrementalInterpolation(const Monomial& variables):
+  m_variables(variables), m_to_zero(variables.ring()),
+  m_to_one(variables.ring()), m_standards(variables.ring()) {}
+
+void IncrementalInterpolation::addZeros(const MonomialSet& points){
+    add(m_to_zero, m_to_one, points);
+}
+
+void IncrementalInterpolation::addZeros(const std::vector<Exponent>& points){
+    addZeros(pointSet(points));
+}
+
+void IncrementalInterpolation::addOnes(const MonomialSet& points){
+    add(m_to_one, m_to_zero, points);
+}
+
+void IncrementalInterpolation::addOnes(const std::vector<Exponent>& points){
+    addOnes(pointSet(points));
+}
+
+void IncrementalInterpolation::add(MonomialSet& target,
+                                   const MonomialSet& other,
+                                   const MonomialSet& points){
+    if PBORI_UNLIKELY(!points.intersect(other).isZero())
+      throw std::runtime_error("Interpolation points with both values zero and one.");
+    PBORI_ASSERT(points.diff(m_variables.divisors()).isZero());
+
+    target=target.unite(points);
+    staircase_map current;
+    m_standards=staircase(this->points(), current);
+    m_staircases.swap(current);
+}
+
+MonomialSet IncrementalInterpolation::staircase(const MonomialSet& points,
+                                                staircase_map& current){
+    MonomialSet::navigator nav=points.navigation();
+    if (nav.isConstant()) return points;
+
+    staircase_map::const_iterator found=current.find(nav);
+    if (found!=current.end()) return found->second.second;
+
+    found=m_staircases.find(nav);
+    MonomialSet result(points.ring());
+    if (found!=m_staircases.end())
+      result=found->second.second;
+    else {
+      MonomialSet p1(points.ring(), nav.thenBranch());
+      MonomialSet p0(points.ring(), nav.elseBranch());
+      result=MonomialSet(*nav, staircase(p1.intersect(p0), current),
+                         staircase(p1.unite(p0), current));
+    }
+    current.insert(std::make_pair(nav, std::make_pair(points, result)));
+    return result;
+}
+
+MonomialSet
+IncrementalInterpolation::pointSet(const std::vector<Exponent>& points) const{
+    // duplicates would cancel out, when adding up
+    std::vector<Exponent> sorted(points);
+    std::sort(sorted.begin(), sorted.end(), LexOrderGreaterComparer());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    return add_up_exponents(sorted, m_variables.ring().zero()).diagram();
+}
+
+Polynomial IncrementalInterpolation::interpolation() const{
+    return interpolate_smallest_lex(m_to_zero, m_to_one);
+}
+
+MonomialSet IncrementalInterpolation::leadingTerms() const{
+    return m_variables.divisors().diff(m_standards).minimalElements();
+}
+
+std::vector<Polynomial> IncrementalInterpolation::groebnerBasis() const{
+    MonomialSet leads=leadingTerms();
+    MonomialSet all_points=points();
+    std::vector<Polynomial> res;
+    res.reserve(leads.size());
+    MonomialSet::const_iterator it=leads.begin();
+    MonomialSet::const_iterator end=leads.end();
+    while(it!=end){
+        Monomial lm=*it;
+        res.push_back(lm+nf_lex_points(lm,all_points));
+        ++it;
+    }
+    return res;
+}
 END_NAMESPACE_PBORIGB
@@ -28,6 +28,9 @@
 #include <polybori/groebner/add_up.h>
 #include <polybori/groebner/polynomial_properties.h>
 #include <polybori/groebner/LexBucket.h>
+#include <polybori/groebner/GeoBucket.h>
+#include <polybori/groebner/DivisorBitMask.h>
+#include <polybori/diagram/CDDForkJoin.h>
 #include <polybori/LexOrder.h>
 #include <iostream>
 #include <polybori/iterators/COrderedIter.h>
@@ -63,6 +66,7 @@ BEGIN_NAMESPACE_PBORIGB
 
 Polynomial nf3(const ReductionStrategy& strat, Polynomial p, Monomial rest_lead){
   int index;
+  GeoBucket bucket(p);
   while((index=strat.select1(rest_lead))>=0){
     PBORI_ASSERT(index<strat.size());
   
@@ -72,19 +76,19 @@ Polynomial nf3(const ReductionStrategy& strat, Polynomial p, Monomial rest_lead)
     (((strat.optBrutalReductions) && (rest_lead!=strat[index].lead))||((strat[index].length<4) &&(strat[index].ecart()==0) 
     && (rest_lead!=strat[index].lead))){
       wlen_type dummy;
-      p=reduce_complete(p,strat[index], dummy);
+      bucket.reset(reduce_complete(bucket.value(),strat[index], dummy));
 
     } else{
       //p=spoly(p,*g);
       Exponent exp=rest_lead.exp();
-      p+=(exp-strat[index].leadExp)*(*g);
+      bucket.add((exp-strat[index].leadExp)*(*g), strat[index].length);
     }
-    if (p.isZero())
-        return p;
+    if (bucket.isZero())
+        return p.ring().zero();
     else
-        rest_lead=p.lead();
+        rest_lead=bucket.lead();
   }
-  return p;
+  return bucket.value();
 }
 
 
@@ -124,6 +128,7 @@ Polynomial nf3_lexbuckets(const GroebnerStrategy& strat, Polynomial p, Monomial
 
 Polynomial nf3_no_deg_growth(const ReductionStrategy& strat, Polynomial p, Monomial rest_lead){
   int index;
+  GeoBucket bucket(p);
   while((index=select_no_deg_growth(strat,rest_lead))>=0){
     PBORI_ASSERT(index<strat.size());
   
@@ -134,25 +139,27 @@ Polynomial nf3_no_deg_growth(const ReductionStrategy& strat, Polynomial p, Monom
 			((strat[index].length<4) &&(strat[index].ecart()==0) && 
 			(rest_lead!=strat[index].lead))){
 			wlen_type dummy;
-      p=reduce_complete(p,strat[index],dummy);
+      bucket.reset(reduce_complete(bucket.value(),strat[index],dummy));
 
     } else{
       //p=spoly(p,*g);
       Exponent exp=rest_lead.exp();
-      p+=(exp-strat[index].leadExp)*(*g);
+      bucket.add((exp-strat[index].leadExp)*(*g), strat[index].length);
     }
-    if (p.isZero())
-        return p;
+    if (bucket.isZero())
+        return p.ring().zero();
     else
-        rest_lead=p.lead();
+        rest_lead=bucket.lead();
   }
-  return p;
+  return bucket.value();
 }
 Polynomial nf3_degree_order(const ReductionStrategy& strat, Polynomial p, Monomial lead){
     int index;
     int deg=p.deg();
     //Monomial lead=p.boundedLead(deg);
     Exponent exp=lead.exp();
+    // terms of summands are bounded by the degree of the current lead
+    GeoBucket bucket(p, deg);
     while((index=strat.select1(lead))>=0){
     PBORI_ASSERT(index<strat.size());
   
@@ -164,6 +171,7 @@ Polynomial nf3_degree_order(const ReductionStrategy& strat, Polynomial p, Monomi
  			&& (lead!=strat[index].lead)))
 
 {     wlen_type dummy;
+      p=bucket.value();
       #ifndef PBORI_NDEBUG
       Polynomial p_old=p;
       #endif
@@ -175,18 +183,19 @@ Polynomial nf3_degree_order(const ReductionStrategy& strat, Polynomial p, Monomi
       #ifndef PBORI_NDEBUG
       PBORI_ASSERT(p.isZero()||p.lead()<p_old.lead());
       #endif
+      bucket.reset(p, deg);
 
     } else{
-      p+=(exp-strat[index].leadExp)*(*g);
+      bucket.add((exp-strat[index].leadExp)*(*g), strat[index].length, deg);
       //p=spoly(p,*g);
     }
-    if (!(p.isZero())){
-        lead=p.boundedLead(deg);
+    if (!(bucket.isZero())){
+        lead=bucket.lead();
         exp=lead.exp();
         deg=exp.deg();
-    } else return p;
+    } else return p.ring().zero();
   }
-  return p;
+  return bucket.value();
 }
 
 Polynomial nf3_short(const ReductionStrategy& strat, Polynomial p){
@@ -562,6 +571,79 @@ int sum_size(const MonomialSet& s1, const MonomialSet& s2){
 // }
 
 
+/// Check, whether the group with leading term lm is reduced by
+/// @c reduce_complete in step_S (then it does not depend on other groups)
+static bool lane_reducible(const BooleMonomial& lm, int index, const GroebnerStrategy& strat){
+  const PolyEntry& reductor=strat.generators[index];
+  return (lm!=reductor.lead) && (reductor.length>2) &&
+    ((strat.generators.optBrutalReductions) ||
+     ((reductor.length<4) && (reductor.ecart()==0)));
+}
+
+/// Pop further groups of equal leading terms, which are suitable for
+/// @c step_S_lanes, from to_reduce (up to strat.reductionLanes groups)
+template <class QueueType>
+static void collect_lanes(QueueType& to_reduce, std::vector<std::vector<PolynomialSugar> >& lanes,
+                          std::vector<int>& indices, GroebnerStrategy& strat,
+                          idx_type last_block_start){
+  while ((lanes.size()<strat.reductionLanes) && (!(to_reduce.empty()))){
+    Monomial lm=to_reduce.top().lead();
+    if ((strat.optLinearAlgebraInLastBlock) && (!(lm.deg()==0)) &&
+        ((*(lm.begin()))>=last_block_start))
+      return;
+    int index=strat.generators.select1(lm);
+    if ((index<0) || (!lane_reducible(lm,index,strat)))
+      return;
+
+    lanes.push_back(std::vector<PolynomialSugar>());
+    indices.push_back(index);
+    while ((!(to_reduce.empty())) && (to_reduce.top().lead()==lm)){
+      lanes.back().push_back(to_reduce.top());
+      to_reduce.pop();
+    }
+  }
+}
+
+/// Variant of step_S for several groups with different leading terms: the
+/// products with the reductors are independent and large ones are computed in
+/// parallel (by forks, which is reused for all rounds of parallel_reduce).
+/// The results are assembled in the original order, hence they do not depend
+/// on the number of threads.
+static void step_S_lanes(std::vector<std::vector<PolynomialSugar> >& lanes,
+                         const std::vector<int>& indices, GroebnerStrategy& strat,
+                         CDDForkJoin& forks){
+  std::vector<CDDForkJoin::deferred_type> products;
+  std::vector<wlen_type> lengths;
+
+  for(std::size_t lane=0;lane<lanes.size();lane++){
+    const PolyEntry& reductor=strat.generators[indices[lane]];
+    for(std::size_t i=0;i<lanes[lane].size();i++){
+      wlen_type new_len=lanes[lane][i].getLengthEstimation();
+      Polynomial factor(reduce_complete_factor(lanes[lane][i].value(),reductor,new_len));
+      lengths.push_back(new_len);
+      if (reductor.p.set().nNodes()+factor.set().nNodes()<CDDForkJoin::default_cutoff)
+        products.push_back(CDDForkJoin::value(reductor.p*factor));
+      else
+        products.push_back(forks.fork(reductor.p,factor));
+    }
+  }
+  if (forks.size()>0)
+    forks.join();
+
+  const bool total_degree=strat.ring().ordering().isTotalDegreeOrder();
+  std::size_t k=0;
+  for(std::size_t lane=0;lane<lanes.size();lane++){
+    for(std::size_t i=0;i<lanes[lane].size();i++,k++){
+      Polynomial to_red=lanes[lane][i].value()+products[k]();
+      if (total_degree)
+        lanes[lane][i]=PolynomialSugar(to_red,lanes[lane][i].getSugar(),lengths[k]);
+      else
+        lanes[lane][i]=PolynomialSugar(to_red);
+    }
+  }
+  forks.clear();
+}
+
 std::vector<Polynomial> parallel_reduce(std::vector<Polynomial> inp, GroebnerStrategy& strat, int average_steps, double delay_f){
 
   
@@ -569,6 +651,12 @@ std::vector<Polynomial> parallel_reduce(std::vector<Polynomial> inp, GroebnerStr
   if (inp.empty())
     return result;
 
+  GroebnerBudget::Run run(strat.budget);
+  // private rings of the worker threads are set up once (on demand)
+  CDDForkJoin forks(strat.ring(),
+                    [](const Polynomial& lhs, const Polynomial& rhs) {
+                      return lhs * rhs;
+                    });
   std::size_t s=inp.size();
   int max_steps=average_steps*s;
   int steps=0;
@@ -627,7 +715,21 @@ std::vector<Polynomial> parallel_reduce(std::vector<Polynomial> inp, GroebnerStr
     }
  
     int index=strat.generators.select1(lm);
-    if (index>=0){
+    std::vector<std::vector<PolynomialSugar> > lanes;
+    std::vector<int> lane_indices;
+    if ((strat.reductionLanes>1) && (index>=0) && (lane_reducible(lm,index,strat))){
+      lanes.push_back(curr);
+      lane_indices.push_back(index);
+      collect_lanes(to_reduce,lanes,lane_indices,strat,last_block_start);
+    }
+    if (lanes.size()>1){
+      step_S_lanes(lanes,lane_indices,strat,forks);
+      curr.clear();
+      for(std::size_t lane=0;lane<lanes.size();lane++){
+        steps=steps+lanes[lane].size();
+        curr.insert(curr.end(),lanes[lane].begin(),lanes[lane].end());
+      }
+    } else if (index>=0){
       steps=steps+curr.size();
       if ((strat.optExchange) && (curr.size()>1)){
         if (strat.generators[index].leadDeg==lm.deg())
@@ -673,6 +775,14 @@ std::vector<Polynomial> parallel_reduce(std::vector<Polynomial> inp, GroebnerStr
       }
     }
     curr.clear();
+    if PBORI_UNLIKELY(strat.budget.exhausted(strat.ring())) {
+        strat.log("Budget exhausted\n");
+        while (!(to_reduce.empty())){
+            strat.addGeneratorDelayed(to_reduce.top().value());
+            to_reduce.pop();
+        }
+        return result;
+    }
     if ((strat.optStepBounded) &&(steps>max_steps)){
         strat.log("Too many steps\n");
         while (!(to_reduce.empty())){
@@ -823,7 +933,65 @@ Polynomial plug_1(const Polynomial& p, const MonomialSet& m_plus_ones){
     return p2;
 }
 
+/// Drop y from all terms of p containing x, where x*y is an element of first
+/// (with x < y) or second (with y < x)
+static Polynomial
+binomial_pairs(const Polynomial& p, MonomialSet::navigator first,
+               MonomialSet::navigator second) {
+
+  Polynomial::navigator p_nav = p.navigation();
+  if (p_nav.isConstant())
+    return p;
+
+  idx_type p_index = *p_nav;
+  while (*first < p_index)
+    first.incrementElse();
+  while (*second < p_index)
+    second.incrementElse();
+  if (first.isConstant() && second.isConstant())
+    return p;
+
+  typedef PBORI::CacheManager<CCacheTypes::binomial_pairs> cache_mgr_type;
+  cache_mgr_type cache_mgr(p.ring());
+  MonomialSet::navigator cached = cache_mgr.find(p_nav, first, second);
+  if (cached.isValid())
+    return cache_mgr.generate(cached);
+
+  Polynomial p1(cache_mgr.generate(p_nav.thenBranch()));
+  Polynomial p0(cache_mgr.generate(p_nav.elseBranch()));
+  MonomialSet::navigator first_next(first), second_next(second);
+  if (*first == p_index) {
+    p1 = plug_1(p1, cache_mgr.generate(first.thenBranch()));
+    first_next.incrementElse();
+  }
+  if (*second == p_index) {
+    MonomialSet irr = mod_mon_set(p1.diagram(),
+                                  cache_mgr.generate(second.thenBranch()));
+    p0 += Polynomial(p1.diagram().diff(irr));
+    p1 = irr;
+    second_next.incrementElse();
+  }
 
+  MonomialSet res(p_index,
+                  binomial_pairs(p1, first_next, second_next).diagram(),
+                  binomial_pairs(p0, first_next, second_next).diagram());
+  cache_mgr.insert(p_nav, first, second, res.navigation());
+  return res;
+}
+
+Polynomial
+binomial_nf(const ReductionStrategy& strat, Polynomial p) {
+  const BinomialReductors& binomials = strat.binomials;
+  Polynomial p_bak(p.ring());
+  while (!p.isZero() && (p != p_bak)) {
+    p_bak = p;
+    p = plug_1(p, binomials.plusOne());
+    p = binomial_pairs(p, binomials.keptFirst().navigation(),
+                       binomials.keptSecond().navigation());
+    p = ll_red_nf(p, binomials.linear());
+  }
+  return p;
+}
 
 Polynomial
 cheap_reductions(const ReductionStrategy& strat, Polynomial p){
@@ -836,7 +1004,7 @@ cheap_reductions(const ReductionStrategy& strat, Polynomial p){
          p=plug_1(p,strat.monomials_plus_one);
          if (strat.optLL){
            
-           p=ll_red_nf(p,strat.llReductor);
+           p=strat.llNormalForm(p);
            if (p_bak!=p){
                p=mod_mon_set(p.diagram(),strat.monomials);
            }
@@ -851,6 +1019,10 @@ cheap_reductions(const ReductionStrategy& strat, Polynomial p){
 
 
 MonomialSet mod_mon_set(const MonomialSet& as, const MonomialSet &vs){
+ MonomialSet result(as.ring());
+ if (DivisorBitMask::modulo(as, vs, result))
+   return result;
+
   typedef PBORI::CacheManager<CCacheTypes::mod_mon_set>
      cache_mgr_type;
  cache_mgr_type cache_mgr(as.ring());
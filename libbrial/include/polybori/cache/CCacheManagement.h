@@ -53,6 +53,7 @@ public:
   struct multiplesof: public binary_cache_tag { };
   struct divisorsof: public binary_cache_tag { };
   struct ll_red_nf: public binary_cache_tag { };
+  struct ll_substitution: public binary_cache_tag { };
   struct plug_1: public binary_cache_tag { };
   struct exist_abstract: public binary_cache_tag { };
 
@@ -68,6 +69,7 @@ public:
   struct interpolate_smallest_lex: public binary_cache_tag { };
   
   struct include_divisors: public unary_cache_tag { };
+  struct lex_standard_monomials: public unary_cache_tag { };
   
   //struct mod_deg2_set: public binary_cache_tag { };
   typedef mod_varset mod_deg2_set;
@@ -96,6 +98,7 @@ public:
   struct has_factor_x_plus_y: public ternary_cache_tag { };
   struct left_equals_right_x_branch_and_r_has_fac_x:
     public ternary_cache_tag { };
+  struct binomial_pairs: public ternary_cache_tag { };
 
   struct graded_part: public binary_cache_tag { };
   struct mapping: public binary_cache_tag { };
@@ -126,6 +129,9 @@ class count_tags<CCacheTypes::left_equals_right_x_branch_and_r_has_fac_x>:
 template<>
 class count_tags<CCacheTypes::has_factor_x_plus_y>:
   public increment_count_tags<CCacheTypes::left_equals_right_x_branch_and_r_has_fac_x>{ };
+template<>
+class count_tags<CCacheTypes::binomial_pairs>:
+  public increment_count_tags<CCacheTypes::has_factor_x_plus_y>{ };
 // generate tag number (special pattern with 4 usable bits)
 // 18 bits are already used
 template <unsigned Counted, unsigned Offset = 18>
@@ -0,0 +1,158 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file CLeadTable.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file contains the definition of the class CLeadTable, which keeps
+ * leading monomials of decision diagrams independently of the computed table.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+**/
+//*****************************************************************************
+
+#ifndef polybori_cache_CLeadTable_h_
+#define polybori_cache_CLeadTable_h_
+
+// include basic definitions
+#include <polybori/pbori_defs.h>
+#include <polybori/ring/CCuddInterface.h>
+#include <polybori/iterators/CCuddNavigator.h>
+#include <polybori/diagram/CNodeCounter.h>
+
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+BEGIN_NAMESPACE_PBORI
+
+/** @class CLeadTable
+ * @brief This class maps diagram nodes to the nodes of their leading
+ * monomials.
+ *
+ * Unlike the entries of the computed table, which are dropped on each cache
+ * flush or garbage collection, both nodes of an entry are referenced by the
+ * table. Hence, an entry is valid as long as it is stored, even if the
+ * polynomial is not used elsewhere in the meantime. Since a reference keeps
+ * the whole diagram alive, the table is bounded by the number of nodes of
+ * the stored diagrams: the oldest entries are released, if more than
+ * @c capacity() nodes are stored, and larger diagrams are not stored at all.
+ *
+ * Entries are keyed by manager and node, so one table can be used for
+ * several managers (which are kept alive by their entries).
+ **/
+class CLeadTable {
+  typedef CLeadTable self;
+
+public:
+  typedef CCuddInterface::mgr_type mgr_type;
+  typedef CCuddInterface::mgr_ptr mgr_ptr;
+  typedef CCuddInterface::node_ptr node_ptr;
+  typedef CTypes::size_type size_type;
+
+  enum { default_capacity = 1 << 16 };
+
+  /// Construct empty table for up to capacity nodes
+  CLeadTable(size_type capacity = default_capacity):
+    m_leads(), m_entries(), m_nodes(0), m_capacity(capacity) {
+    PBORI_ASSERT(capacity > 0);
+  }
+
+  /// Copy constructor (copies capacity only, since entries are owned)
+  CLeadTable(const self& rhs):
+    m_leads(), m_entries(), m_nodes(0), m_capacity(rhs.m_capacity) {}
+
+  /// Destructor
+  ~CLeadTable() { clear(); }
+
+  /// Node of the leading monomial of node (NULL if not stored)
+  node_ptr find(mgr_type* mgr, node_ptr node) const {
+    map_type::const_iterator iter(m_leads.find(key_type(mgr, node)));
+    return (iter == m_leads.end()? NULL: iter->second);
+  }
+
+  /// Store lead as leading monomial of node
+  void insert(mgr_type* mgr, node_ptr node, node_ptr lead) {
+    size_type nodes = CNodeCounter<CCuddNavigator>()(CCuddNavigator(node)) +
+      CNodeCounter<CCuddNavigator>()(CCuddNavigator(lead));
+    if PBORI_UNLIKELY(nodes > m_capacity)
+      return;
+
+    if (!m_leads.insert(map_type::value_type(key_type(mgr, node),
+                                             lead)).second)
+      return;
+
+    PBORI_PREFIX(Cudd_Ref)(node);
+    PBORI_PREFIX(Cudd_Ref)(lead);
+    m_entries.push_back(entry_type(mgr, node, lead, nodes));
+    m_nodes += nodes;
+
+    while (m_nodes > m_capacity)
+      release();
+  }
+
+  /// Release all entries
+  void clear() {
+    while (!m_entries.empty())
+      release();
+  }
+
+  /// Number of stored entries
+  size_type size() const { return m_entries.size(); }
+
+  /// Number of nodes of the stored diagrams (shared ones counted repeatedly)
+  size_type nodes() const { return m_nodes; }
+
+  /// Maximal number of nodes of the stored diagrams
+  size_type capacity() const { return m_capacity; }
+
+private:
+  /// Entries are owned, so they may not be shared by assignment
+  self& operator=(const self&);
+
+  /// Stored entry, keeps its manager alive
+  struct entry_type {
+    entry_type(mgr_type* mgr_, node_ptr node_, node_ptr lead_,
+               size_type nodes_):
+      mgr(mgr_), node(node_), lead(lead_), nodes(nodes_) {}
+
+    mgr_ptr mgr;
+    node_ptr node, lead;
+    size_type nodes;
+  };
+
+  /// Remove oldest entry and dereference both nodes
+  void release() {
+    PBORI_ASSERT(!m_entries.empty());
+    entry_type& entry = m_entries.front();
+    m_leads.erase(key_type(entry.mgr.get(), entry.node));
+    PBORI_PREFIX(Cudd_RecursiveDerefZdd)(entry.mgr.get(), entry.lead);
+    PBORI_PREFIX(Cudd_RecursiveDerefZdd)(entry.mgr.get(), entry.node);
+    m_nodes -= entry.nodes;
+    m_entries.pop_front();
+  }
+
+  typedef std::pair<mgr_type*, node_ptr> key_type;
+
+  /// Hash of manager and node
+  struct hash_type {
+    std::size_t operator()(const key_type& key) const {
+      return std::hash<node_ptr>()(key.second) * 31 +
+        std::hash<mgr_type*>()(key.first);
+    }
+  };
+
+  typedef std::unordered_map<key_type, node_ptr, hash_type> map_type;
+
+  map_type m_leads;
+  /// Entries in order of insertion
+  std::deque<entry_type> m_entries;
+  size_type m_nodes, m_capacity;
+};
+
+END_NAMESPACE_PBORI
+
+#endif
@@ -0,0 +1,140 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file CInlineStack.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file defines the class template CInlineStack, a stack with inline
+ * storage for its first elements.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_common_CInlineStack_h_
+#define polybori_common_CInlineStack_h_
+
+// include basic definitions
+#include <polybori/pbori_defs.h>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+BEGIN_NAMESPACE_PBORI
+
+/** @class CInlineStack
+ * @brief This class defines a stack of (cheaply copyable) values, which
+ * stores up to @c InlineCapacity elements without allocating memory.
+ *
+ * Stacks of navigators along the path of a term are bounded by the degree of
+ * the term (plus one). Hence, they usually fit into the inline storage, and
+ * constructing, copying and assigning them does not use the heap. Only if
+ * the inline storage is exceeded, the elements are moved to heap memory.
+ **/
+template <class ValueType, unsigned InlineCapacity = 32>
+class CInlineStack {
+
+  /// Type of *this
+  typedef CInlineStack self;
+
+public:
+  typedef ValueType value_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef const value_type* const_iterator;
+  typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef std::size_t size_type;
+
+  /// Construct empty stack
+  CInlineStack(): m_data(m_inline), m_size(0), m_capacity(InlineCapacity),
+                  m_heap() {}
+
+  /// Copy constructor
+  CInlineStack(const self& rhs):
+    m_data(m_inline), m_size(0), m_capacity(InlineCapacity), m_heap() {
+    append(rhs.begin(), rhs.end());
+  }
+
+  /// Assignment
+  self& operator=(const self& rhs) {
+    if PBORI_LIKELY(this != &rhs) {
+      clear();
+      append(rhs.begin(), rhs.end());
+    }
+    return *this;
+  }
+
+  bool empty() const { return (m_size == 0); }
+  size_type size() const { return m_size; }
+
+  const_iterator begin() const { return m_data; }
+  const_iterator end() const { return m_data + m_size; }
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  }
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  }
+
+  reference front() { PBORI_ASSERT(!empty()); return m_data[0]; }
+  const_reference front() const { PBORI_ASSERT(!empty()); return m_data[0]; }
+  reference back() { PBORI_ASSERT(!empty()); return m_data[m_size - 1]; }
+  const_reference back() const {
+    PBORI_ASSERT(!empty());
+    return m_data[m_size - 1];
+  }
+
+  void push_back(const value_type& value) {
+    if PBORI_UNLIKELY(m_size == m_capacity)
+      reserve(2 * m_capacity);
+    m_data[m_size++] = value;
+  }
+
+  void pop_back() {
+    PBORI_ASSERT(!empty());
+    --m_size;
+  }
+
+  /// Remove all elements (memory on the heap is kept for reuse)
+  void clear() { m_size = 0; }
+
+  /// Push [start, finish) in this order
+  template <class IteratorType>
+  void append(IteratorType start, IteratorType finish) {
+    size_type nsize = m_size + std::distance(start, finish);
+    if PBORI_UNLIKELY(nsize > m_capacity)
+      reserve(std::max<size_type>(nsize, 2 * m_capacity));
+    std::copy(start, finish, m_data + m_size);
+    m_size = nsize;
+  }
+
+  bool operator==(const self& rhs) const {
+    return (m_size == rhs.m_size) && std::equal(begin(), end(), rhs.begin());
+  }
+  bool operator!=(const self& rhs) const { return !(*this == rhs); }
+
+private:
+  /// Move elements to heap memory for at least nsize elements
+  void reserve(size_type nsize) {
+    PBORI_ASSERT(nsize > m_capacity);
+    std::vector<value_type> heap(nsize);
+    std::copy(begin(), end(), heap.begin());
+    m_heap.swap(heap);
+    m_data = &m_heap[0];
+    m_capacity = nsize;
+  }
+
+  value_type* m_data;
+  size_type m_size, m_capacity;
+  value_type m_inline[InlineCapacity];
+  /// Storage used instead of m_inline, if the latter is too small
+  std::vector<value_type> m_heap;
+};
+
+END_NAMESPACE_PBORI
+
+#endif /* polybori_common_CInlineStack_h_ */
@@ -0,0 +1,348 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file CDDForkJoin.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file defines the class CDDForkJoin, which evaluates independent
+ * operations on decision diagrams in parallel, and the fork-join variant
+ * @c dd_multiply_forked of @c dd_multiply.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_diagram_CDDForkJoin_h_
+#define polybori_diagram_CDDForkJoin_h_
+
+// include basic definitions
+#include <polybori/pbori_defs.h>
+#include <polybori/BoolePolynomial.h>
+#include <polybori/cache/CacheManager.h>
+#include <polybori/routines/pbori_routines.h>
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+BEGIN_NAMESPACE_PBORI
+
+/** @class CDDForkJoin
+ * @brief This class collects independent binary operations on diagrams of a
+ * ring and evaluates them in parallel.
+ *
+ * The decision diagram manager is not thread-safe. Hence, each worker thread
+ * owns a private manager (and computed table): it imports its operands node by
+ * node, applies the operation and the results are imported back after all
+ * workers have finished. The manager of the ring is only read while its
+ * owning thread is waiting in @c join().
+ *
+ * Usage: @c fork() returns a deferred result, which may be evaluated after
+ * the next @c join() (only). An instance may be used for several rounds of
+ * @c fork() and @c join(), the private managers are created once (on demand)
+ * and reused. Results are kept until @c clear() is called.
+ *
+ * @note The worker rings use the default ordering, hence operations must not
+ * depend on the ordering of the ring.
+ **/
+class CDDForkJoin {
+  typedef CDDForkJoin self;
+
+public:
+  typedef BoolePolynomial poly_type;
+  typedef BoolePolyRing ring_type;
+  typedef BooleSet dd_type;
+  typedef dd_type::navigator navigator;
+  typedef dd_type::size_type size_type;
+
+  /// Type of the operation (called in worker threads, on worker rings)
+  typedef std::function<poly_type(const poly_type&, const poly_type&)>
+  operation_type;
+
+  /// Type of results available after @c join()
+  typedef std::function<poly_type()> deferred_type;
+
+  /// Default minimal number of nodes worth forking for
+  enum { default_cutoff = 10000 };
+
+  /// Construct for operations on diagrams of given ring, using at most
+  /// @c nthreads worker threads (default: number of hardware threads)
+  CDDForkJoin(const ring_type& ring,
+              const operation_type& operation = operation_type(),
+              size_type nthreads = 0):
+    m_ring(ring), m_operation(operation),
+    m_nthreads(nthreads > 0? nthreads:
+               std::max<size_type>(1, std::thread::hardware_concurrency())),
+    m_operands(), m_tasks(), m_results(), m_workers() { }
+
+  /// Schedule default operation for lhs and rhs
+  deferred_type fork(const poly_type& lhs, const poly_type& rhs) {
+    return fork(m_operation, lhs, rhs);
+  }
+
+  /// Schedule given operation for lhs and rhs
+  deferred_type fork(const operation_type& operation, const poly_type& lhs,
+                     const poly_type& rhs) {
+    PBORI_ASSERT(operation);
+    m_operands.push_back(lhs);
+    m_operands.push_back(rhs);
+    m_tasks.push_back(task_type(operation, lhs.navigation(),
+                                rhs.navigation()));
+
+    size_type idx = m_results.size() + m_tasks.size() - 1;
+    const std::vector<poly_type>& results = m_results;
+    return [&results, idx]() {
+      PBORI_ASSERT(idx < results.size());
+      return results[idx];
+    };
+  }
+
+  /// Wrap value, which is available immediately
+  static deferred_type value(const poly_type& poly) {
+    return [poly]() { return poly; };
+  }
+
+  /// Number of scheduled operations, which are not joined yet
+  size_type size() const { return m_tasks.size(); }
+
+  /// Maximal number of worker threads
+  size_type threads() const { return m_nthreads; }
+
+  /// Evaluate all scheduled operations
+  void join() {
+    if (m_tasks.empty())
+      return;
+
+    size_type nthreads = std::min<size_type>(m_tasks.size(), m_nthreads);
+    while (m_workers.size() < nthreads)
+      m_workers.push_back(worker_type(ring_type(m_ring.nVariables())));
+
+    std::vector<std::thread> threads;
+    for (size_type idx = 0; idx < nthreads; ++idx)
+      threads.push_back(std::thread(&self::run, this, std::ref(m_workers[idx]),
+                                    idx, nthreads));
+    std::for_each(threads.begin(), threads.end(),
+                  std::mem_fn(&std::thread::join));
+
+    for (size_type idx = 0; idx < nthreads; ++idx)
+      if PBORI_UNLIKELY(m_workers[idx].error) {
+        std::exception_ptr error = m_workers[idx].error;
+        reset(nthreads);
+        std::rethrow_exception(error);
+      }
+
+    // results are distributed round-robin over the workers
+    map_type imported;
+    m_results.reserve(m_results.size() + m_tasks.size());
+    for (size_type idx = 0; idx < m_tasks.size(); ++idx)
+      m_results.push_back(transfer(m_ring, m_workers[idx % nthreads].
+                                   results[idx / nthreads].navigation(),
+                                   imported));
+    reset(nthreads);
+  }
+
+  /// Drop all results (deferred results of previous rounds become invalid)
+  void clear() {
+    PBORI_ASSERT(m_tasks.empty());
+    m_results.clear();
+  }
+
+protected:
+  typedef std::unordered_map<navigator::pointer_type, dd_type> map_type;
+
+  /// Scheduled operation and its operands
+  struct task_type {
+    task_type(const operation_type& operation_, navigator first_,
+              navigator second_):
+      operation(operation_), first(first_), second(second_) { }
+
+    operation_type operation;
+    navigator first, second;
+  };
+
+  /// Private manager and results of a worker thread
+  struct worker_type {
+    worker_type(const ring_type& ring_):
+      ring(ring_), results(), error() { }
+
+    ring_type ring;
+    std::vector<poly_type> results;
+    std::exception_ptr error;
+  };
+
+  /// Apply operation for every step-th task, beginning with start
+  void run(worker_type& worker, size_type start, size_type step) const {
+    try {
+      map_type imported;
+      for (size_type idx = start; idx < m_tasks.size(); idx += step)
+        worker.results.push_back(
+          m_tasks[idx].operation(transfer(worker.ring, m_tasks[idx].first,
+                                          imported),
+                                 transfer(worker.ring, m_tasks[idx].second,
+                                          imported)));
+    }
+    catch (...) {
+      worker.error = std::current_exception();
+    }
+  }
+
+  /// Forget tasks of the last round (and intermediate data of the workers)
+  void reset(size_type nthreads) {
+    m_tasks.clear();
+    m_operands.clear();
+    for (size_type idx = 0; idx < nthreads; ++idx) {
+      m_workers[idx].results.clear();
+      m_workers[idx].error = std::exception_ptr();
+    }
+  }
+
+  /// Rebuild a diagram (from another manager) node by node in given ring
+  static dd_type
+  transfer(const ring_type& ring, navigator navi, map_type& imported) {
+    if (navi.isConstant())
+      return ring.constant(navi.terminalValue());
+
+    map_type::const_iterator found = imported.find(navi.getNode());
+    if (found != imported.end())
+      return found->second;
+
+    dd_type result(*navi, transfer(ring, navi.thenBranch(), imported),
+                   transfer(ring, navi.elseBranch(), imported));
+    imported.insert(std::make_pair(navi.getNode(), result));
+    return result;
+  }
+
+private:
+  CDDForkJoin(const self&);
+  self& operator=(const self&);
+
+  ring_type m_ring;
+  operation_type m_operation;
+  size_type m_nthreads;
+  std::vector<poly_type> m_operands;
+  std::vector<task_type> m_tasks;
+  std::vector<poly_type> m_results;
+  std::vector<worker_type> m_workers;
+};
+
+/// Multiply polynomials (serially) by @c dd_multiply
+template <bool use_fast>
+BoolePolynomial
+dd_multiply_polynomials(const BoolePolynomial& lhs,
+                        const BoolePolynomial& rhs) {
+  typedef CommutativeCacheManager<CCacheTypes::multiply_recursive>
+    cache_mgr_type;
+
+  return dd_multiply<use_fast>(cache_mgr_type(lhs.ring()), lhs.navigation(),
+                               rhs.navigation(), BoolePolynomial(lhs.ring()));
+}
+
+/// Schedule the top-most @c depth levels of @c dd_multiply into @c forks
+template <bool use_fast>
+CDDForkJoin::deferred_type
+dd_multiply_fork(CDDForkJoin& forks, const BoolePolynomial& first,
+                 const BoolePolynomial& second, unsigned depth) {
+
+  typedef BoolePolynomial poly_type;
+  typedef BooleSet dd_type;
+  typedef dd_type::navigator navigator;
+
+  navigator firstNavi(first.navigation()), secondNavi(second.navigation());
+
+  // trivial cases are computed immediately
+  if (firstNavi.isConstant() || secondNavi.isConstant() ||
+      (firstNavi == secondNavi))
+    return CDDForkJoin::value(dd_multiply_polynomials<use_fast>(first,
+                                                                second));
+  if (depth == 0)
+    return forks.fork(&dd_multiply_polynomials<use_fast>, first, second);
+
+  if (*secondNavi < *firstNavi)
+    std::swap(firstNavi, secondNavi);
+
+  const BoolePolyRing& ring = first.ring();
+  dd_type::idx_type top = *firstNavi;
+  poly_type as0(dd_type(ring, firstNavi.elseBranch()));
+  poly_type as1(dd_type(ring, firstNavi.thenBranch()));
+  poly_type bs0(dd_type(ring, secondNavi)), bs1(ring.zero());
+
+  if (*secondNavi == top) {
+    bs0 = dd_type(ring, secondNavi.elseBranch());
+    bs1 = dd_type(ring, secondNavi.thenBranch());
+  }
+
+  CDDForkJoin::deferred_type result0 =
+    dd_multiply_fork<use_fast>(forks, as0, bs0, depth - 1);
+
+  // addends of the then-branch (same cases as in dd_multiply)
+  std::vector<CDDForkJoin::deferred_type> result1;
+  if (use_fast && (*secondNavi == top)) {
+    result1.push_back(dd_multiply_fork<use_fast>(forks, as1 + as0, bs0 + bs1,
+                                                 depth - 1));
+    result1.push_back(result0);
+  }
+  else if (as0 == as1) {
+    result1.push_back(dd_multiply_fork<use_fast>(forks, bs0, as1, depth - 1));
+  }
+  else {
+    result1.push_back(dd_multiply_fork<use_fast>(forks, as0, bs1, depth - 1));
+    if (bs0 != bs1)
+      result1.push_back(dd_multiply_fork<use_fast>(forks, bs0 + bs1, as1,
+                                                   depth - 1));
+  }
+
+  return [top, result0, result1]() {
+    poly_type then_branch(result1.front()());
+    for (std::size_t idx = 1; idx < result1.size(); ++idx)
+      then_branch += result1[idx]();
+
+    return poly_type(dd_type(top, then_branch.diagram(),
+                             result0().diagram()));
+  };
+}
+
+/// Multiply polynomials, the independent branches of the top-most @c depth
+/// levels are multiplied in parallel by @c forks
+/// @note Diagrams with less than @c cutoff nodes are multiplied serially. The
+/// other operations scheduled into @c forks are joined as well.
+template <bool use_fast>
+BoolePolynomial
+dd_multiply_forked(CDDForkJoin& forks, const BoolePolynomial& lhs,
+                   const BoolePolynomial& rhs, unsigned depth = 2,
+                   CDDForkJoin::size_type cutoff = CDDForkJoin::default_cutoff) {
+
+  if ((depth == 0) || (lhs.set().nNodes() + rhs.set().nNodes() < cutoff))
+    return dd_multiply_polynomials<use_fast>(lhs, rhs);
+
+  CDDForkJoin::deferred_type result =
+    dd_multiply_fork<use_fast>(forks, lhs, rhs, depth);
+  forks.join();
+
+  return result();
+}
+
+/// Multiply polynomials, the independent branches of the top-most @c depth
+/// levels are multiplied in parallel
+/// @note Diagrams with less than @c cutoff nodes are multiplied serially.
+template <bool use_fast>
+BoolePolynomial
+dd_multiply_forked(const BoolePolynomial& lhs, const BoolePolynomial& rhs,
+                   unsigned depth = 2,
+                   CDDForkJoin::size_type cutoff = CDDForkJoin::default_cutoff) {
+
+  if ((depth == 0) || (lhs.set().nNodes() + rhs.set().nNodes() < cutoff))
+    return dd_multiply_polynomials<use_fast>(lhs, rhs);
+
+  CDDForkJoin forks(lhs.ring());
+  return dd_multiply_forked<use_fast>(forks, lhs, rhs, depth, cutoff);
+}
+
+END_NAMESPACE_PBORI
+
+#endif /* polybori_diagram_CDDForkJoin_h_ */
@@ -21,6 +21,7 @@
 
 // include basic definitions
 #include <polybori/pbori_defs.h>
+#include <polybori/common/CInlineStack.h>
 
 // Get forward term iterator
 #include "CTermIter.h"
@@ -29,11 +30,11 @@ BEGIN_NAMESPACE_PBORI
 
 template<class NavigatorType>
 class handle_else :
-  public std::deque<NavigatorType> {
+  public CInlineStack<NavigatorType> {
 public:
 
   typedef NavigatorType navigator_type;
-  typedef std::deque<NavigatorType> base;
+  typedef CInlineStack<NavigatorType> base;
 
   void operator()(const navigator_type& navi) {
 
@@ -49,7 +50,7 @@ public:
 
   void append(const handle_else& rhs) {
     PBORI_ASSERT(base::empty() || rhs.empty() || ((**rhs.begin()) > (*top())) );
-    base::insert(base::end(), rhs.begin(), rhs.end());
+    base::append(rhs.begin(), rhs.end());
   }
 };
 
@@ -26,6 +26,7 @@
 
 #include "CStackSelector.h"
 #include "CTermGenerator.h"
+#include "CTermView.h"
 
 
 BEGIN_NAMESPACE_PBORI
@@ -127,6 +128,7 @@ public:
   typedef typename iterator_core::const_iterator const_iterator;
   typedef typename iterator_core::const_reverse_iterator 
   const_reverse_iterator;
+  typedef CTermView<const_iterator> view_type;
   typedef typename iterator_core::size_type size_type;
   typedef typename iterator_core::deg_type deg_type;
   typedef typename iterator_core::idx_type idx_type;
@@ -182,6 +184,9 @@ public:
   const_reverse_iterator rbegin() const { return p_iter->rbegin(); }
   const_reverse_iterator rend() const { return p_iter->rend(); }
 
+  /// View of current term (valid until *this is changed)
+  view_type view() const { return view_type(begin(), end(), deg()); }
+
   deg_type deg() const { return p_iter->deg(); }
   idx_type firstIndex() const { return *begin(); }
 
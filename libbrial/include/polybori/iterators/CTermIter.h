@@ -29,6 +29,7 @@
 #include <boost/iterator/iterator_facade.hpp>
 
 #include <polybori/BooleEnv.h>
+#include "CTermView.h"
 
 
 BEGIN_NAMESPACE_PBORI
@@ -77,6 +78,7 @@ public:
   typedef typename stack_type::const_iterator const_iterator;
   typedef typename stack_type::const_reverse_iterator 
   const_reverse_iterator;
+  typedef CTermView<const_iterator> view_type;
   //@}
 
   /// Copy constructor
@@ -120,6 +122,9 @@ public:
   const_iterator end() const { return m_stack.end(); }
   const_reverse_iterator rbegin() const { return m_stack.rbegin(); }
   const_reverse_iterator rend() const { return m_stack.rend(); }
+
+  /// View of current term (valid until *this is changed)
+  view_type view() const { return view_type(begin(), end(), deg()); }
   //@}
 
   /// Determine whether term is one (without explicit constructing)
@@ -29,6 +29,7 @@
 
 // include polybori properties
 #include <polybori/common/traits.h>
+#include <polybori/common/CInlineStack.h>
 
 #include <polybori/routines/pbori_routines.h>
  
@@ -143,8 +144,8 @@ public:
   typedef typename navigator::bool_type bool_type;
 
 
-  /// Define type for stacking
-  typedef std::deque<navigator> stack_type;
+  /// Define type for stacking (terms of small degree need no allocation)
+  typedef CInlineStack<navigator> stack_type;
 
   typedef typename stack_type::reference       reference;
   typedef typename stack_type::const_reference const_reference;
@@ -332,7 +333,7 @@ protected:
   template <class TermStack>
   void append(const TermStack& rhs) { 
     PBORI_ASSERT(empty() || rhs.empty() || ((*rhs.begin()) > (*top())) );
-    m_stack.insert(m_stack.end(), rhs.m_stack.begin(), rhs.m_stack.end());
+    m_stack.append(rhs.m_stack.begin(), rhs.m_stack.end());
   }
 
 
@@ -0,0 +1,73 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file CTermView.h
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * This file defines the class template CTermView, which gives access to the
+ * current term of a term iterator without constructing it.
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+**/
+//*****************************************************************************
+
+#ifndef polybori_iterators_CTermView_h_
+#define polybori_iterators_CTermView_h_
+
+// include basic definitions
+#include <polybori/pbori_defs.h>
+
+BEGIN_NAMESPACE_PBORI
+
+/** @class CTermView
+ * @brief This class is a light-weight view of the (ascending) indices of the
+ * current term of a term iterator, like an exponent.
+ *
+ * It refers to the stack of the iterator, hence it is valid until the
+ * iterator is changed.
+ **/
+template <class IteratorType>
+class CTermView {
+
+  /// Type of *this
+  typedef CTermView self;
+
+public:
+  typedef IteratorType const_iterator;
+  typedef CTypes::size_type size_type;
+  typedef CTypes::deg_type deg_type;
+
+  /// Construct from indices [start, finish) of a term of degree deg
+  CTermView(const_iterator start, const_iterator finish, deg_type deg):
+    m_start(start), m_finish(finish), m_deg(deg) {}
+
+  const_iterator begin() const { return m_start; }
+  const_iterator end() const { return m_finish; }
+
+  size_type size() const { return m_deg; }
+  deg_type deg() const { return m_deg; }
+
+  /// Check whether the term is one
+  bool isOne() const { return (m_deg == 0); }
+
+  /// Copy indices to exponent exp (reusing its memory)
+  template <class ExpType>
+  ExpType& copyTo(ExpType& exp) const {
+    exp.resize(0);
+    exp.reserve(m_deg);
+    for (const_iterator start(m_start); start != m_finish; ++start)
+      exp.push_back(*start);
+    return exp;
+  }
+
+private:
+  const_iterator m_start, m_finish;
+  deg_type m_deg;
+};
+
+END_NAMESPACE_PBORI
+
+#endif /* polybori_iterators_CTermView_h_ */
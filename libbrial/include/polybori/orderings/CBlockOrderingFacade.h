@@ -17,6 +17,7 @@
 #define polybori_orderings_CBlockOrderingFacade_h_
 
 #include "COrderingFacade.h"
+#include <polybori/cache/CLeadTable.h>
 
 BEGIN_NAMESPACE_PBORI
 
@@ -48,13 +49,14 @@ public:
   //@}
 
   /// Default Constructor
-  CBlockOrderingFacade(): base_type(), m_indices() {
+  CBlockOrderingFacade(): base_type(), m_indices(), m_leads() {
     m_indices.push_back(0);
     m_indices.push_back(CTypes::max_index()); 
   };
 
   /// Copy Constructor
-  CBlockOrderingFacade(const self& rhs): base_type(rhs), m_indices(rhs.m_indices) {};
+  CBlockOrderingFacade(const self& rhs):
+    base_type(rhs), m_indices(rhs.m_indices), m_leads(rhs.m_leads) {};
 
   /// Destructor
   ~CBlockOrderingFacade() = 0;
@@ -75,25 +77,30 @@ public:
 
     m_indices.back() = idx;
     m_indices.push_back(CTypes::max_index());
+    m_leads.clear();
   }
 
   void clearBlocks() {
     m_indices.clear();
     m_indices.push_back(0); 
     m_indices.push_back(CTypes::max_index());
+    m_leads.clear();
   }
   //@}
 
-  /// generic block lead
+  /// generic block lead (kept in a table, which survives cache flushes)
   monom_type lead(const poly_type& poly) const {
 
-    CBlockDegreeCache<set_type> blockDegCache(poly.ring());
-    CacheManager<order_lead_tag> cache_mgr(poly.ring());
-    typename base_type::descending_property descending;
+    CCuddInterface::node_ptr lead_node =
+      m_leads.find(poly.ring().getManager(), poly.navigation().getNode());
+    if PBORI_LIKELY(lead_node != NULL)
+      return base_type::monom(set_type(poly.ring(), lead_node));
 
-    return base_type::monom( dd_block_degree_lead(cache_mgr, blockDegCache, 
-                                        poly.navigation(), m_indices.begin(),
-                                        set_type(poly.ring()), descending) );
+    monom_type result(uncachedLead(poly));
+    m_leads.insert(poly.ring().getManager(),
+                   poly.navigation().getNode(),
+                   result.diagram().navigation().getNode());
+    return result;
   }
 
   /// Leading monomial with bound (just the ordinary leading monomial)
@@ -115,6 +122,18 @@ public:
 
 protected:
 
+  /// Block lead using the computed table only
+  monom_type uncachedLead(const poly_type& poly) const {
+
+    CBlockDegreeCache<set_type> blockDegCache(poly.ring());
+    CacheManager<order_lead_tag> cache_mgr(poly.ring());
+    typename base_type::descending_property descending;
+
+    return base_type::monom( dd_block_degree_lead(cache_mgr, blockDegCache, 
+                                        poly.navigation(), m_indices.begin(),
+                                        set_type(poly.ring()), descending) );
+  }
+
   /// Comparison of monomials/expoinents template
   template <class TermType, class BinOpType>
   comp_type compare_terms(const TermType& lhs, const TermType& rhs,
@@ -126,6 +145,9 @@ protected:
 
   /// index data
   COrderingBase::block_idx_type m_indices;
+
+  /// Leading monomials of recently used polynomials (w.r.t. m_indices)
+  mutable CLeadTable m_leads;
 };
 
 template <class OrderType, class OrderTag>
@@ -0,0 +1,148 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file BitslicedEvaluatorTest.cc
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-19
+ *
+ * boost/test-driven unit test
+ * 
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+ **/
+//*****************************************************************************
+
+
+#include <boost/test/unit_test.hpp>
+#include <boost/version.hpp>
+#if BOOST_VERSION < 107100
+#include <boost/test/output_test_stream.hpp>
+#else
+#include <boost/test/tools/output_test_stream.hpp>
+#endif
+
+using boost::test_tools::output_test_stream;
+
+#include <polybori/groebner/BitslicedEvaluator.h>
+#include <polybori/groebner/interpolate.h>
+#include <algorithm>
+#include <string>
+
+USING_NAMESPACE_PBORI
+USING_NAMESPACE_PBORIGB
+
+struct Fbitsliced {
+  Fbitsliced() { BOOST_TEST_MESSAGE( "setup fixture" ); }
+  ~Fbitsliced() { BOOST_TEST_MESSAGE( "teardown fixture" ); }
+};
+
+BOOST_FIXTURE_TEST_SUITE(BitslicedEvaluatorTestSuite, Fbitsliced )
+
+BOOST_AUTO_TEST_CASE(test_bitsliced_zeros) {
+
+  BoolePolyRing sring(12, COrderEnums::lp);
+  BooleMonomial all(sring);
+  for (unsigned i = 0; i < 12; ++i)
+    all *= sring.variable(i);
+  BooleSet points = all.divisors();
+  BooleSet some = zeros(sring.variable(0) * sring.variable(5) + sring.variable(9),
+               points);
+
+  BoolePolynomial polys[] = {
+    sring.variable(0) * sring.variable(3) * sring.variable(11) +
+    sring.variable(1) * sring.variable(2) + sring.variable(4) +
+    sring.variable(7) * sring.variable(8) + 1,
+    sring.variable(3) * sring.variable(5) + sring.variable(6),
+    BoolePolynomial(1, sring), BoolePolynomial(0, sring),
+    (sring.variable(0) + sring.variable(1)) *
+    (sring.variable(2) + sring.variable(5) + 1) *
+    (sring.variable(6) + sring.variable(10)) + sring.variable(11)
+  };
+  for (unsigned i = 0; i < 5; ++i) {
+    BitslicedEvaluator evaluator(polys[i]);
+    BOOST_CHECK_LE(evaluator.size(), polys[i].diagram().nNodes());
+    for (unsigned nthreads = 1; nthreads <= 3; ++nthreads) {
+      BOOST_CHECK(evaluator.zeros(points, nthreads) ==
+                  zeros(polys[i], points));
+      BOOST_CHECK(evaluator.zeros(some, nthreads) == zeros(polys[i], some));
+    }
+
+    BitslicedEvaluator::bitmap_type bitmap = evaluator.zeroBitmap(some);
+    BOOST_CHECK_EQUAL(bitmap.size(),
+      (some.size() + BitslicedEvaluator::word_bits - 1) /
+      BitslicedEvaluator::word_bits);
+    unsigned idx = 0;
+    for (BooleSet::const_iterator start(some.begin()); start != some.end();
+         ++start, ++idx) {
+      bool bit = (bitmap[idx / BitslicedEvaluator::word_bits] >>
+                  (idx % BitslicedEvaluator::word_bits)) & 1;
+      BOOST_CHECK_EQUAL(bit, zeros(polys[i], start->set()) == start->set());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_bitsliced_system) {
+
+  BoolePolyRing sring(10, COrderEnums::lp);
+  BoolePolynomial shared = sring.variable(4) * sring.variable(7) +
+    sring.variable(8) * sring.variable(9) + sring.variable(6);
+  std::vector<BoolePolynomial> system;
+  system.push_back(sring.variable(0) * shared + sring.variable(1));
+  system.push_back(sring.variable(2) * sring.variable(3) * shared + 1);
+  system.push_back(shared);
+  system.push_back(sring.variable(1) + sring.variable(5));
+  system.push_back(BoolePolynomial(1, sring));
+
+  BitslicedEvaluator evaluator(system);
+  BOOST_CHECK_EQUAL(evaluator.nOutputs(), system.size());
+  BitslicedEvaluator::size_type separate = 0;
+  for (unsigned j = 0; j < system.size(); ++j)
+    separate += BitslicedEvaluator(system[j]).size();
+  BOOST_CHECK_LT(evaluator.size(), separate);
+
+  std::vector<BooleExponent> points;
+  unsigned seed = 3;
+  for (unsigned i = 0; i < 1500; ++i) {
+    BooleExponent point;
+    for (unsigned var = 0; var < 10; ++var) {
+      seed = seed * 1103515245u + 12345u;
+      if ((seed >> 16) & 1)
+        point.push_back(var);
+    }
+    points.push_back(point);
+  }
+  for (unsigned nthreads = 1; nthreads <= 2; ++nthreads) {
+    std::vector<BitslicedEvaluator::bitmap_type> values =
+      evaluator.values(points, nthreads);
+    BOOST_CHECK_EQUAL(values.size(), system.size());
+    for (unsigned j = 0; j < system.size(); ++j)
+      for (unsigned i = 0; i < points.size(); i += 7) {
+        BooleSet point = BooleMonomial(points[i], sring).set();
+        bool value = (values[j][i / BitslicedEvaluator::word_bits] >>
+                      (i % BitslicedEvaluator::word_bits)) & 1;
+        BOOST_CHECK_EQUAL(value, zeros(system[j], point).isZero());
+      }
+  }
+
+  BooleMonomial all(sring);
+  for (unsigned i = 0; i < 10; ++i)
+    all *= sring.variable(i);
+  system.pop_back();
+  BooleSet common = all.divisors();
+  for (unsigned j = 0; j < system.size(); ++j)
+    common = zeros(system[j], common);
+  BOOST_CHECK(BitslicedEvaluator(system).zeros(all.divisors()) == common);
+
+  output_test_stream output;
+  evaluator.writeC(output, "evaluate_system");
+  std::string code = output.str();
+  BOOST_CHECK(code.find("void evaluate_system(const uint64_t* x, "
+                        "uint64_t* y) {") != std::string::npos);
+  BOOST_CHECK(code.find("  y[4] = ~(uint64_t)0;") != std::string::npos);
+  // declaration of the temporaries, instructions and outputs
+  BOOST_CHECK_EQUAL(std::count(code.begin(), code.end(), ';'),
+                    1 + evaluator.size() + evaluator.nOutputs());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
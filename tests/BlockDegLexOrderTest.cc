@@ -398,6 +398,90 @@ BOOST_AUTO_TEST_CASE(test_lead_blocks) {
   BOOST_CHECK_NE(blockorder.leadExp(poly, 0), order.leadExp(poly, 0));
 }
 
+BOOST_AUTO_TEST_CASE(test_lead_table) {
+
+  BOOST_TEST_MESSAGE( "lead kept over cache flushes and block changes" );
+  order_type blockorder;
+  blockorder.appendBlock(2);
+
+  BoolePolynomial poly = y*x + y*z*v*w + v*w + z*w;
+  BOOST_CHECK_EQUAL(blockorder.lead(poly), BooleMonomial(x*y));
+  ring.clearCache();
+  BOOST_CHECK_EQUAL(blockorder.lead(poly), BooleMonomial(x*y));
+  BOOST_CHECK_EQUAL(blockorder.leadExp(poly), BooleExponent(x*y));
+
+  blockorder.clearBlocks();
+  BOOST_CHECK_EQUAL(blockorder.lead(poly), BooleMonomial(y*z*v*w));
+  blockorder.appendBlock(3);
+  BOOST_CHECK_EQUAL(blockorder.lead(poly), BooleMonomial(x*y));
+
+  order_type copied(blockorder);
+  BOOST_CHECK_EQUAL(copied.lead(poly), BooleMonomial(x*y));
+
+  BoolePolyRing other(5, COrderEnums::lp);
+  BooleMonomial other_lead =
+    BooleVariable(1, other)*BooleVariable(2, other)*BooleVariable(3, other);
+  BoolePolynomial other_poly = other_lead + BooleVariable(0, other);
+  BOOST_CHECK_EQUAL(blockorder.lead(other_poly), other_lead);
+  BOOST_CHECK_EQUAL(blockorder.lead(poly), BooleMonomial(x*y));
+
+  BooleVariable vars[] = {x, y, z, v, w};
+  std::vector<BooleMonomial> terms(32, BooleMonomial(ring));
+  for (unsigned idx = 0; idx < terms.size(); ++idx)
+    for (unsigned var = 0; var < 5; ++var)
+      if (idx & (1 << var))
+        terms[idx] *= vars[var];
+
+  for (unsigned idx = 1; idx < 5000; ++idx) {
+    BoolePolynomial summed(ring);
+    BooleMonomial expected(ring);
+    for (unsigned term = 0; term < 13; ++term)
+      if (idx & (1 << term)) {
+        summed += terms[term + 19];
+        if (blockorder.compare(terms[term + 19], expected) ==
+            CTypes::greater_than)
+          expected = terms[term + 19];
+      }
+    BOOST_CHECK_EQUAL(blockorder.lead(summed), expected);
+  }
+  BOOST_CHECK_EQUAL(blockorder.lead(poly), BooleMonomial(x*y));
+
+  // entries survive cache flushes, are kept per manager and bounded by nodes
+  CLeadTable table(64);
+  BooleMonomial lead = x*y;
+  table.insert(ring.getManager(), poly.navigation().getNode(),
+               lead.diagram().navigation().getNode());
+  table.insert(other.getManager(), other_poly.navigation().getNode(),
+               other_lead.diagram().navigation().getNode());
+  ring.clearCache();
+  other.clearCache();
+  BOOST_CHECK_EQUAL(table.size(), 2);
+  BOOST_CHECK(table.find(ring.getManager(), poly.navigation().getNode()) ==
+              lead.diagram().navigation().getNode());
+  BOOST_CHECK(table.find(other.getManager(),
+                         other_poly.navigation().getNode()) ==
+              other_lead.diagram().navigation().getNode());
+  BOOST_CHECK(table.find(ring.getManager(),
+                         other_poly.navigation().getNode()) == NULL);
+
+  for (unsigned idx = 1; idx < 200; ++idx) {
+    BoolePolynomial summed(ring);
+    for (unsigned term = 0; term < 8; ++term)
+      if (idx & (1 << term))
+        summed += terms[term + 19];
+    table.insert(ring.getManager(), summed.navigation().getNode(),
+                 blockorder.lead(summed).diagram().navigation().getNode());
+    BOOST_CHECK(table.nodes() <= table.capacity());
+  }
+  BOOST_CHECK(table.find(ring.getManager(), poly.navigation().getNode()) ==
+              NULL);
+
+  CLeadTable small(4);
+  small.insert(ring.getManager(), poly.navigation().getNode(),
+               lead.diagram().navigation().getNode());
+  BOOST_CHECK_EQUAL(small.size(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(test_cover_constructors_and_destructors) {
   int order_code = CTypes::block_dlex;
   BoolePolyRing block_ring(5, order_code);
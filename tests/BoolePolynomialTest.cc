@@ -1154,6 +1154,50 @@ BOOST_AUTO_TEST_CASE(test_incompatible) {
 
 }
 
+BOOST_AUTO_TEST_CASE(test_ordered_term_views) {
+
+  BOOST_TEST_MESSAGE( "Views of ordered terms (also of large degree)..." );
+  COrderEnums::ordercodes orders[] = {COrderEnums::lp, COrderEnums::dlex,
+                                      COrderEnums::dp_asc,
+                                      COrderEnums::block_dlex,
+                                      COrderEnums::block_dp_asc};
+  for (unsigned order = 0; order < 5; ++order) {
+    BoolePolyRing ring(80, orders[order]);
+    if (ring.ordering().isBlockOrder()) {
+      ring.ordering().appendBlock(20);
+      ring.ordering().appendBlock(50);
+    }
+
+    BooleMonomial large(ring);
+    for (unsigned idx = 0; idx < 70; ++idx)
+      large *= ring.variable(idx);
+    BoolePolynomial poly = BoolePolynomial(large) + large / ring.variable(3) +
+      ring.variable(1) * ring.variable(60) + ring.variable(45) +
+      ring.variable(2) * ring.variable(21) * ring.variable(79) + 1;
+
+    BooleExponent viewed;
+    BoolePolynomial::ordered_exp_iterator
+      start(poly.orderedExpBegin()), finish(poly.orderedExpEnd());
+    std::vector<BooleExponent> terms;
+    while (start != finish) {
+      BoolePolynomial::ordered_exp_iterator previous(start++);
+      BOOST_CHECK_EQUAL(previous.view().deg(), (*previous).deg());
+      BOOST_CHECK_EQUAL(previous.view().copyTo(viewed), *previous);
+      terms.push_back(viewed);
+    }
+    BOOST_CHECK_EQUAL(terms.size(), poly.length());
+    BOOST_CHECK(terms.back().deg() == 0);
+    for (unsigned idx = 1; idx < terms.size(); ++idx)
+      BOOST_CHECK_EQUAL(ring.ordering().compare(terms[idx - 1], terms[idx]),
+                        CTypes::greater_than);
+
+    BoolePolynomial::const_iterator lex_start(poly.begin());
+    BOOST_CHECK_EQUAL(lex_start.view().deg(), 70);
+    BOOST_CHECK(std::equal(lex_start.view().begin(), lex_start.view().end(),
+                           (*lex_start).begin()));
+  }
+}
+
 
 
 BOOST_AUTO_TEST_CASE(test_inSingleBlock) {
@@ -30,6 +30,7 @@ using boost::test_tools::output_test_stream;
 #include <polybori/BooleExponent.h>
 #include <polybori/BoolePolyRing.h>
 #include <polybori/orderings/pbori_order.h>
+#include <polybori/diagram/CDDForkJoin.h>
 #include <vector>
 
 BEGIN_NAMESPACE_PBORI
@@ -632,4 +633,43 @@ BOOST_AUTO_TEST_CASE(test_size) {
   BOOST_CHECK_EQUAL(diagram.nNodes(), 3);
 }
 
+BOOST_AUTO_TEST_CASE(test_fork_join) {
+
+  BOOST_TEST_MESSAGE( "dd_multiply_forked" );
+  BoolePolynomial lhs = poly * (x + w) + y*v*w + z + 1;
+  BoolePolynomial rhs = x*z*w + y*v + w*x + v + 1;
+  BoolePolynomial serial = lhs * rhs;
+
+  // cutoff zero enforces forking even for small diagrams
+  for (unsigned depth = 0; depth < 4; ++depth) {
+    BOOST_CHECK_EQUAL(dd_multiply_forked<false>(lhs, rhs, depth, 0), serial);
+    BOOST_CHECK_EQUAL(dd_multiply_forked<true>(lhs, rhs, depth, 0), serial);
+    BOOST_CHECK_EQUAL(dd_multiply_forked<false>(lhs, lhs, depth, 0),
+                      lhs * lhs);
+  }
+  BOOST_CHECK_EQUAL(dd_multiply_forked<false>(lhs, BoolePolynomial(1, ring),
+                                              2, 0), lhs);
+  BOOST_CHECK_EQUAL(dd_multiply_forked<false>(BoolePolynomial(0, ring), rhs,
+                                              2, 0), BoolePolynomial(0, ring));
+
+  // a context is reused for several rounds, results are kept until clear()
+  for (CDDForkJoin::size_type nthreads = 1; nthreads < 4; ++nthreads) {
+    CDDForkJoin forks(ring, CDDForkJoin::operation_type(), nthreads);
+    BOOST_CHECK_EQUAL(forks.threads(), nthreads);
+    BoolePolynomial first = dd_multiply_forked<false>(forks, lhs, rhs, 2, 0);
+    CDDForkJoin::deferred_type sum =
+      forks.fork([](const BoolePolynomial& first,
+                    const BoolePolynomial& second) { return first + second; },
+                 lhs, rhs);
+    BOOST_CHECK_EQUAL(forks.size(), 1);
+    forks.join();
+    BOOST_CHECK_EQUAL(forks.size(), 0);
+    BOOST_CHECK_EQUAL(first, serial);
+    BOOST_CHECK_EQUAL(sum(), lhs + rhs);
+    forks.clear();
+    BOOST_CHECK_EQUAL(dd_multiply_forked<true>(forks, lhs, lhs, 3, 0),
+                      lhs * lhs);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
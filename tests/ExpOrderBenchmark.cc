@@ -0,0 +1,81 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file ExpOrderBenchmark.cc
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * Benchmark for sorting exponents by the virtual ordering interface and by
+ * the inlined comparisons of ExpOrderDispatch.h.
+ *
+ * Usage: ExpOrderBenchmark [number of exponents (default: 10^7)]
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+ **/
+//*****************************************************************************
+
+#include <polybori/groebner/ExpOrderDispatch.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+USING_NAMESPACE_PBORI
+USING_NAMESPACE_PBORIGB
+
+static double
+seconds_since(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start).count();
+}
+
+int
+main(int argc, char** argv) {
+
+  const std::size_t nexps = (argc > 1? std::strtoul(argv[1], NULL, 10):
+                             10000000);
+  const unsigned nvars = 64;
+
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<unsigned> degree(0, 8), variable(0, nvars - 1);
+  std::vector<BooleExponent> exps(nexps);
+  for (std::size_t idx = 0; idx < nexps; ++idx) {
+    for (unsigned deg = degree(generator); deg > 0; --deg)
+      exps[idx].insert(variable(generator));
+  }
+
+  const char* names[] = {"lp", "dlex", "dp_asc", "block_dlex",
+                         "block_dp_asc"};
+  COrderEnums::ordercodes orders[] = {COrderEnums::lp, COrderEnums::dlex,
+                                      COrderEnums::dp_asc,
+                                      COrderEnums::block_dlex,
+                                      COrderEnums::block_dp_asc};
+  for (unsigned order = 0; order < 5; ++order) {
+    BoolePolyRing ring(nvars, orders[order]);
+    if (orders[order] == COrderEnums::block_dlex ||
+        orders[order] == COrderEnums::block_dp_asc) {
+      ring.ordering().appendBlock(nvars / 4);
+      ring.ordering().appendBlock(nvars / 2);
+    }
+
+    std::vector<BooleExponent> dynamic(exps), dispatched(exps);
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    std::sort(dynamic.begin(), dynamic.end(),
+              ExpGreaterBy<OrderingExpCompare>(OrderingExpCompare(ring)));
+    double virtual_time = seconds_since(start);
+
+    start = std::chrono::steady_clock::now();
+    sort_exp_greater(dispatched.begin(), dispatched.end(), ring);
+    double inlined_time = seconds_since(start);
+
+    std::cout << names[order] << ": virtual " << virtual_time
+              << "s, inlined " << inlined_time << "s"
+              << (dynamic == dispatched? "": " (MISMATCH)") << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,126 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file ExpOrderDispatchTest.cc
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-19
+ *
+ * boost/test-driven unit test
+ * 
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+ **/
+//*****************************************************************************
+
+
+#include <boost/test/unit_test.hpp>
+#include <boost/version.hpp>
+#if BOOST_VERSION < 107100
+#include <boost/test/output_test_stream.hpp>
+#else
+#include <boost/test/tools/output_test_stream.hpp>
+#endif
+
+using boost::test_tools::output_test_stream;
+
+#include <polybori/groebner/ExpOrderDispatch.h>
+#include <polybori/groebner/ExpGreater.h>
+#include <algorithm>
+#include <vector>
+
+USING_NAMESPACE_PBORI
+USING_NAMESPACE_PBORIGB
+
+struct Fdispatch {
+  Fdispatch() { BOOST_TEST_MESSAGE( "setup fixture" ); }
+  ~Fdispatch() { BOOST_TEST_MESSAGE( "teardown fixture" ); }
+};
+
+BOOST_FIXTURE_TEST_SUITE(ExpOrderDispatchTestSuite, Fdispatch )
+
+BOOST_AUTO_TEST_CASE(test_exp_order_dispatch) {
+
+  COrderEnums::ordercodes orders[] = {COrderEnums::lp, COrderEnums::dlex,
+                                      COrderEnums::dp_asc,
+                                      COrderEnums::block_dlex,
+                                      COrderEnums::block_dp_asc};
+  for (unsigned order = 0; order < 5; ++order) {
+    BoolePolyRing sring(9, orders[order]);
+    if (order >= 3) {
+      sring.ordering().appendBlock(3);
+      sring.ordering().appendBlock(7);
+    }
+    std::vector<BooleExponent> exps;
+    unsigned seed = 11;
+    for (unsigned i = 0; i < 300; ++i) {
+      BooleExponent exp;
+      for (unsigned var = 0; var < 9; ++var) {
+        seed = seed * 1103515245u + 12345u;
+        if (((seed >> 16) % 3) == 0)
+          exp.push_back(var);
+      }
+      exps.push_back(exp);
+    }
+
+    DispatchedExpCompare compare(sring);
+    for (unsigned i = 0; i + 1 < exps.size(); ++i)
+      BOOST_CHECK_EQUAL(compare(exps[i], exps[i + 1]),
+                        sring.ordering().compare(exps[i], exps[i + 1]));
+
+    std::vector<BooleExponent> expected(exps);
+    std::stable_sort(expected.begin(), expected.end(),
+                     [&sring](const BooleExponent& lhs,
+                              const BooleExponent& rhs) {
+                       return sring.ordering().compare(lhs, rhs) ==
+                         CTypes::greater_than;
+                     });
+    std::vector<BooleExponent> heap(exps);
+    sort_exp_greater(exps.begin(), exps.end(), sring);
+    for (unsigned i = 0; i < exps.size(); ++i)
+      BOOST_CHECK_EQUAL(exps[i], expected[i]);
+
+    std::make_heap(heap.begin(), heap.end(), ExpGreater(sring));
+    std::sort_heap(heap.begin(), heap.end(), ExpGreater(sring));
+    for (unsigned i = 0; i < heap.size(); ++i)
+      BOOST_CHECK_EQUAL(heap[i], expected[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_lex_sorted_to_ring_order) {
+
+  COrderEnums::ordercodes orders[] = {COrderEnums::lp, COrderEnums::dlex,
+                                      COrderEnums::dp_asc,
+                                      COrderEnums::block_dlex,
+                                      COrderEnums::block_dp_asc};
+  for (unsigned order = 0; order < 5; ++order) {
+    BoolePolyRing sring(10, orders[order]);
+    if (order >= 3) {
+      sring.ordering().appendBlock(4);
+      sring.ordering().appendBlock(6);
+    }
+    BoolePolynomial poly(sring);
+    unsigned seed = 5;
+    for (unsigned i = 0; i < 400; ++i) {
+      BooleMonomial term(sring);
+      for (unsigned var = 0; var < 10; ++var) {
+        seed = seed * 1103515245u + 12345u;
+        if (((seed >> 16) % 3) == 0)
+          term *= sring.variable(var);
+      }
+      poly += term;
+    }
+    BooleSet terms = poly.diagram();
+    std::vector<BooleExponent> exps(terms.expBegin(), terms.expEnd());
+    std::vector<std::size_t> positions =
+      lex_sorted_to_ring_order(exps, sring);
+
+    std::vector<BooleExponent> expected(exps);
+    sort_exp_greater(expected.begin(), expected.end(), sring);
+    BOOST_CHECK_EQUAL(positions.size(), expected.size());
+    for (unsigned i = 0; i < positions.size(); ++i)
+      BOOST_CHECK_EQUAL(exps[positions[i]], expected[i]);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
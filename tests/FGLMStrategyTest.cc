@@ -76,6 +76,60 @@ BOOST_AUTO_TEST_CASE(test_constructors) {
 
 }
 
+BOOST_AUTO_TEST_CASE(test_change_of_ordering) {
+
+  BoolePolyRing other(ring.clone());
+  other.changeOrdering(CTypes::dp_asc);
+
+  BooleVariable a(5, ring), b(6, ring), c(7, ring);
+  BoolePolynomial system[] = {x*y + z*a + b + 1, y*c + v*w + x,
+                              x*z*b + a*c + y + 1, v*a + w*b + c*x};
+
+  GroebnerStrategy from_strat(ring), to_strat(other);
+  for (unsigned i = 0; i < 4; ++i) {
+    from_strat.addGeneratorDelayed(system[i]);
+    to_strat.addGeneratorDelayed(other.coerce(system[i]));
+  }
+  from_strat.symmGB_F2();
+  to_strat.symmGB_F2();
+  PolynomialVector expected = to_strat.minimalizeAndTailReduce();
+
+  FGLMStrategy strat(ring, other, from_strat.minimalizeAndTailReduce());
+  PolynomialVector ideal = strat.main();
+
+  // same ideal, hence the same reduced basis
+  GroebnerStrategy result_strat(other);
+  for (unsigned i = 0; i < ideal.size(); ++i)
+    result_strat.addGeneratorDelayed(ideal[i]);
+  result_strat.symmGB_F2();
+  PolynomialVector result = result_strat.minimalizeAndTailReduce();
+
+  BOOST_CHECK_EQUAL(result.size(), expected.size());
+  for (unsigned i = 0; (i < result.size()) && (i < expected.size()); ++i)
+    BOOST_CHECK_EQUAL(result[i], expected[i]);
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_tables) {
+
+  BoolePolyRing other(ring.clone());
+  other.changeOrdering(CTypes::dp_asc);
+
+  BooleVariable a(5, ring), b(6, ring), c(7, ring), d(8, ring), e(9, ring);
+  GroebnerStrategy from_strat(ring);
+  from_strat.addGeneratorDelayed(x*y*a + z*b + c*d + e + 1);
+  from_strat.addGeneratorDelayed(y*c*e + v*w + x*d + a);
+  from_strat.symmGB_F2();
+  PolynomialVector gb = from_strat.minimalizeAndTailReduce();
+
+  PolynomialVector expected = FGLMStrategy(ring, other, gb, 1).main();
+  for (unsigned nthreads = 2; nthreads < 5; ++nthreads) {
+    PolynomialVector result = FGLMStrategy(ring, other, gb, nthreads).main();
+    BOOST_CHECK_EQUAL(result.size(), expected.size());
+    for (unsigned i = 0; (i < result.size()) && (i < expected.size()); ++i)
+      BOOST_CHECK_EQUAL(result[i], expected[i]);
+  }
+}
+
 /// @note It is intended, that the following two tests do not compile!
 #ifdef FGLMStrategyTest_compile_all_
 BOOST_AUTO_TEST_CASE(test_copy_constructor) {
@@ -25,9 +25,39 @@
 using boost::test_tools::output_test_stream;
 
 #include <polybori/groebner/groebner_alg.h>
+#include <polybori/groebner/SignatureStrategy.h>
+#include <polybori/groebner/GeoBucket.h>
+#include <polybori/groebner/minimal_elements.h>
+#include <polybori/groebner/tables.h>
+#include <polybori/groebner/interpolate.h>
+#include <polybori/groebner/nf.h>
+#include <sstream>
+#include <set>
+#include <queue>
+#include <chrono>
+#include <thread>
 
 USING_NAMESPACE_PBORI
 USING_NAMESPACE_PBORIGB
+
+// The given basis coincides with the reduced Groebner basis of the system
+// computed by the plain strategy (up to the order of the elements)
+static void
+check_reduced_basis(const std::vector<BoolePolynomial>& system,
+                    const std::vector<BoolePolynomial>& result) {
+
+  GroebnerStrategy plain(system.front().ring());
+  for (std::size_t i = 0; i < system.size(); ++i)
+    plain.addGeneratorDelayed(system[i]);
+  plain.symmGB_F2();
+
+  std::vector<BoolePolynomial> expected = plain.minimalizeAndTailReduce();
+  BOOST_CHECK_EQUAL(result.size(), expected.size());
+  for (std::size_t i = 0; i < result.size(); ++i)
+    BOOST_CHECK(std::find(expected.begin(), expected.end(), result[i]) !=
+                expected.end());
+}
+
 struct Fstrat {
   Fstrat(const BoolePolyRing& input_ring = BoolePolyRing(1000)): 
     ring(input_ring),
@@ -56,4 +86,755 @@ BOOST_AUTO_TEST_CASE(test_nf) {
   BOOST_CHECK_EQUAL(strat.nf(poly), BoolePolynomial(0 ,ring));
 }
 
+BOOST_AUTO_TEST_CASE(test_generators_index) {
+
+  ReductionStrategy generators(ring);
+  for (int i=0;i<500;i++){
+    BooleVariable xi(i, ring), xj(i+1, ring);
+    generators.addGenerator(PolyEntry(xi*xj + xi + 1));
+  }
+
+  BOOST_CHECK_EQUAL(generators.size(), 500u);
+  for (int i=0;i<500;i+=7){
+    BooleMonomial lead = BooleVariable(i, ring) * BooleVariable(i+1, ring);
+    BOOST_CHECK_EQUAL((int)generators.index(lead), i);
+    BOOST_CHECK_EQUAL((int)generators.index(lead.exp()), i);
+    BOOST_CHECK_EQUAL(generators[lead].lead, lead);
+  }
+  BOOST_CHECK_EQUAL((int)generators.checked_index(BooleMonomial(x*z)), -1);
+  BOOST_CHECK_EQUAL((int)generators.checked_index(BooleMonomial(x*z).exp()), -1);
+
+  // exchanging an element changes its keys
+  generators.exchange(BooleMonomial(x*y), PolyEntry(x*v + 1));
+  BOOST_CHECK_EQUAL((int)generators.checked_index(BooleMonomial(x*y)), -1);
+  BOOST_CHECK_EQUAL((int)generators.checked_index(BooleMonomial(x*y).exp()), -1);
+  BOOST_CHECK_EQUAL((int)generators.index(BooleMonomial(x*v)), 0);
+  BOOST_CHECK_EQUAL((int)generators.index(BooleMonomial(x*v).exp()), 0);
+  BOOST_CHECK_EQUAL((int)generators.index(BooleMonomial(y*z)), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_budget_and_resume) {
+
+  BoolePolynomial system[] = {x*y + z*v + w + 1, y*z + v*w + x,
+                              x*w + y*v + z + v, z*w*v + x*v + y + 1};
+
+  GroebnerStrategy full(ring);
+  GroebnerStrategy bounded(ring);
+  for (unsigned i = 0; i < 4; ++i) {
+    full.addGeneratorDelayed(system[i]);
+    bounded.addGeneratorDelayed(system[i]);
+  }
+  full.symmGB_F2();
+  BOOST_CHECK(!full.budget.interrupted());
+
+  bounded.budget.maxDegree = 1;
+  bounded.symmGB_F2();
+  BOOST_CHECK(bounded.budget.interrupted());
+  BOOST_CHECK(!bounded.pairs.pairSetEmpty());
+
+  std::stringstream stored;
+  bounded.save(stored);
+
+  GroebnerStrategy resumed(ring);
+  resumed.load(stored);
+  BOOST_CHECK_EQUAL(resumed.generators.size(), bounded.generators.size());
+  BOOST_CHECK_EQUAL(resumed.pairs.queue.size(), bounded.pairs.queue.size());
+  for (unsigned i = 0; i < resumed.generators.size(); ++i)
+    BOOST_CHECK_EQUAL(resumed.generators[i].p, bounded.generators[i].p);
+
+  resumed.symmGB_F2();
+  BOOST_CHECK(!resumed.budget.interrupted());
+  BOOST_CHECK(resumed.pairs.pairSetEmpty());
+
+  std::vector<BoolePolynomial> expected = full.minimalizeAndTailReduce();
+  std::vector<BoolePolynomial> result = resumed.minimalizeAndTailReduce();
+  BOOST_CHECK_EQUAL(result.size(), expected.size());
+  for (unsigned i = 0; i < result.size(); ++i)
+    BOOST_CHECK(std::find(expected.begin(), expected.end(), result[i]) !=
+                expected.end());
+
+  // saved data of another ring is rejected
+  std::stringstream other;
+  bounded.save(other);
+  GroebnerStrategy foreign(BoolePolyRing(5));
+  BOOST_CHECK_THROW(foreign.load(other), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_save_load_fields) {
+
+  const char* prefixes[] = {"", "  leading blanks", "matrix\nlines "};
+  for (unsigned idx = 0; idx < 3; ++idx) {
+    GroebnerStrategy strat(ring);
+    strat.addGeneratorDelayed(x*y + z);
+    strat.addGeneratorDelayed(y*z + v + 1);
+    strat.matrixPrefix = prefixes[idx];
+    strat.reductionSteps = 17;
+    strat.normalForms = 5;
+    strat.currentDegree = 3;
+    strat.averageLength = 4;
+    strat.chainCriterions = 2;
+
+    std::stringstream stored;
+    strat.save(stored);
+
+    GroebnerStrategy resumed(ring);
+    resumed.load(stored);
+    BOOST_CHECK_EQUAL(resumed.matrixPrefix, prefixes[idx]);
+    BOOST_CHECK_EQUAL(resumed.reductionSteps, 17u);
+    BOOST_CHECK_EQUAL(resumed.normalForms, 5);
+    BOOST_CHECK_EQUAL(resumed.currentDegree, 3);
+    BOOST_CHECK_EQUAL(resumed.averageLength, 4);
+    BOOST_CHECK_EQUAL(resumed.chainCriterions, 2);
+    BOOST_CHECK_EQUAL(resumed.pairs.queue.size(), strat.pairs.queue.size());
+  }
+
+  // other versions of the layout are rejected
+  GroebnerStrategy strat(ring);
+  std::stringstream stored;
+  strat.save(stored);
+  std::string data = stored.str();
+  std::stringstream version;
+  version << "BRiAl-GroebnerStrategy " << GroebnerStrategy::save_format_version;
+  BOOST_CHECK_EQUAL(data.find(version.str()), 0u);
+  data.replace(0, version.str().size(), "BRiAl-GroebnerStrategy 1");
+  std::stringstream outdated(data);
+  GroebnerStrategy rejected(ring);
+  BOOST_CHECK_THROW(rejected.load(outdated), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_inconsistent_system) {
+
+  // the 1 only shows up when reducing S-polynomials
+  BoolePolynomial systems[][4] = {
+    {x*y + z, x*y + z + 1, ring.zero(), ring.zero()},
+    {x*y + z, y*z + x, x*z + y + 1, x + z + 1},
+    {x*y*z + v, x*y + w, z*w + v + 1, v*w + x}};
+  for (unsigned idx = 0; idx < 3; ++idx) {
+    GroebnerStrategy strat(ring);
+    for (unsigned i = 0; i < 4; ++i)
+      if (!systems[idx][i].isZero())
+        strat.addGeneratorDelayed(systems[idx][i]);
+    strat.symmGB_F2();
+    BOOST_CHECK(strat.containsOne());
+    std::vector<BoolePolynomial> result = strat.minimalizeAndTailReduce();
+    BOOST_CHECK_EQUAL(result.size(), 1);
+    if (!result.empty())
+      BOOST_CHECK(result.front().isOne());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_budget_clock) {
+
+  // the clock starts with the call, not with the construction of strat
+  GroebnerStrategy strat(ring);
+  strat.budget.maxSeconds = 0.5;
+  std::this_thread::sleep_for(std::chrono::milliseconds(600));
+
+  std::vector<BoolePolynomial> system;
+  system.push_back(x*y + z);
+  system.push_back(x*y + v + 1);
+  std::vector<BoolePolynomial> result = parallel_reduce(system, strat, 10, 2.);
+  BOOST_CHECK(!strat.budget.interrupted());
+  BOOST_CHECK(!result.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_pair_queue) {
+
+  GroebnerStrategy strat(ring);
+  BoolePolynomial polys[] = {x*y + z, y*z + v, x*w + 1, v*w + x, z*w + y};
+  for (unsigned i = 0; i < 5; ++i)
+    strat.generators.addGenerator(PolyEntry(polys[i]));
+
+  std::priority_queue<PairE, std::vector<PairE>, PairECompare>
+    expected((PairECompare(ring)));
+  PairQueue queue(ring);
+  for (int i = 0; i < 5; ++i)
+    for (int j = i + 1; j < 5; ++j) {
+      Pair pair(i, j, strat.generators);
+      pair.sugar = (i * 7 + j * 3) % 5;
+      expected.push(pair);
+      queue.push(pair);
+    }
+
+  // a copy shares the nodes, modifications do not affect each other
+  PairQueue copy(queue);
+  copy.pop();
+  copy.push(Pair(x*y*z));
+  BOOST_CHECK_EQUAL(queue.size(), expected.size());
+  BOOST_CHECK_EQUAL(copy.size(), expected.size());
+
+  for (PairQueue other(queue); !expected.empty(); expected.pop()) {
+    BOOST_REQUIRE(!queue.empty());
+    BOOST_CHECK_EQUAL(queue.top().sugar, expected.top().sugar);
+    BOOST_CHECK(queue.top().lm == expected.top().lm);
+    queue.pop();
+  }
+  BOOST_CHECK(queue.empty());
+  BOOST_CHECK_EQUAL(copy.size(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(test_snapshot) {
+
+  BoolePolynomial system[] = {x*y + z*v + w + 1, y*z + v*w + x,
+                              x*w + y*v + z + v};
+
+  GroebnerStrategy strat(ring);
+  for (unsigned i = 0; i < 3; ++i)
+    strat.addGeneratorDelayed(system[i]);
+  strat.budget.maxDegree = 2;
+  strat.symmGB_F2();
+  strat.budget.maxDegree = -1;
+
+  std::vector<BoolePolynomial> before;
+  for (unsigned i = 0; i < strat.generators.size(); ++i)
+    before.push_back(strat.generators[i].p);
+  std::size_t pairs = strat.pairs.queue.size();
+
+  // branching on x and x + 1 leaves the parent untouched
+  for (unsigned value = 0; value < 2; ++value) {
+    GroebnerStrategy branch(strat);
+    branch.addGeneratorDelayed(x + BoolePolynomial(value == 1, ring));
+    branch.symmGB_F2();
+    BOOST_CHECK(branch.pairs.pairSetEmpty());
+    BOOST_CHECK(branch.generators.size() > 0);
+    BOOST_CHECK_EQUAL(branch.nf(x + BoolePolynomial(value == 1, ring)),
+                      BoolePolynomial(0, ring));
+
+    BOOST_CHECK_EQUAL(strat.generators.size(), before.size());
+    BOOST_CHECK_EQUAL(strat.pairs.queue.size(), pairs);
+    for (unsigned i = 0; i < before.size(); ++i)
+      BOOST_CHECK_EQUAL(strat.generators[i].p, before[i]);
+  }
+
+  strat.symmGB_F2();
+  BOOST_CHECK(strat.pairs.pairSetEmpty());
+  BOOST_CHECK(!strat.budget.interrupted());
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_spolys) {
+
+  BoolePolynomial system[] = {x*y + z*v + w + 1, y*z + v*w + x,
+                              x*w + y*v + z + v, z*w*v + x*v + y + 1};
+
+  GroebnerStrategy strat(ring);
+  for (unsigned i = 0; i < 4; ++i) {
+    BoolePolynomial poly = strat.nf(system[i]);
+    if (!poly.isZero())
+      strat.addGenerator(PolyEntry(poly));
+  }
+  BOOST_REQUIRE(!strat.pairs.pairSetEmpty());
+
+  // selection updates the status in order, construction is independent
+  std::vector<Pair> selected;
+  for (strat.pairs.cleanTopByChainCriterion(); !strat.pairs.pairSetEmpty();
+       strat.pairs.cleanTopByChainCriterion())
+    selected.push_back(strat.nextPair());
+  for (unsigned i = 0; i < strat.generators.size(); ++i)
+    for (idx_type idx = 0; idx < 5; ++idx)
+      selected.push_back(Pair(i, idx, strat.generators, VARIABLE_PAIR));
+  selected.push_back(Pair(x*y*z + v));
+
+  NextSpoly spolys(strat.generators, strat.pairs.status);
+  std::vector<BoolePolynomial> expected;
+  for (unsigned i = 0; i < selected.size(); ++i)
+    expected.push_back(spolys.construct(selected[i]));
+
+  // cutoff zero enforces forking even for small diagrams
+  for (CDDForkJoin::size_type nthreads = 1; nthreads < 5; ++nthreads) {
+    CDDForkJoin forks(ring, CDDForkJoin::operation_type(), nthreads);
+    std::vector<BoolePolynomial> result;
+    spolys.construct(selected.begin(), selected.end(), result, forks, 0);
+    BOOST_CHECK(result == expected);
+  }
+  std::vector<BoolePolynomial> result;
+  CDDForkJoin forks(ring);
+  spolys.construct(selected.begin(), selected.end(), result, forks);
+  BOOST_CHECK(result == expected);
+}
+
+BOOST_AUTO_TEST_CASE(test_ll_red_nf_forked) {
+
+  LLReductor reductors(ring);
+  reductors.update(PolyEntry(z + v + w));
+  reductors.update(PolyEntry(y + v*w + 1));
+  reductors.update(PolyEntry(x + y*z));
+
+  BoolePolynomial polys[] = {x*y*v + z*w + x + y + v*w*x,
+                             x*y*z*v*w + x*z + y*w + 1, x, v*w + 1};
+  for (unsigned i = 0; i < 4; ++i) {
+    BoolePolynomial expected = ll_red_nf(polys[i], reductors);
+    BOOST_CHECK_EQUAL(ll_red_nf_forked(polys[i], reductors), expected);
+
+    // cutoff zero enforces forking even for small diagrams
+    for (unsigned depth = 1; depth < 4; ++depth) {
+      BOOST_CHECK_EQUAL((ll_red_nf_generic<true, false, false>(
+                          polys[i], reductors.navigation(), depth, 0)),
+                        expected);
+      BOOST_CHECK_EQUAL((ll_red_nf_generic<false, false, false>(
+                          polys[i], reductors.navigation(), depth, 0)),
+                        ll_red_nf_noredsb(polys[i], reductors));
+      BOOST_CHECK_EQUAL((ll_red_nf_generic<false, true, false>(
+                          polys[i], reductors.navigation(), depth, 0)),
+                        ll_red_nf_noredsb_single_recursive_call(polys[i],
+                                                                reductors));
+    }
+  }
+
+  // one fork-join context serves several reductions with two threads
+  CDDForkJoin forks(ring, CDDForkJoin::operation_type(), 2);
+  LLReduction<false, true, false> reduction(ring);
+  for (unsigned i = 0; i < 4; ++i) {
+    BOOST_CHECK_EQUAL(reduction(forks, polys[i], reductors.navigation(), 2, 0),
+                      ll_red_nf_noredsb_single_recursive_call(polys[i],
+                                                              reductors));
+    forks.clear();
+  }
+
+  // parallel reduction by the linear-lead reductors of a strategy
+  ReductionStrategy generators(ring);
+  generators.optLL = true;
+  generators.llForkDepth = 2;
+  generators.addGenerator(PolyEntry(z + v + w));
+  generators.addGenerator(PolyEntry(y + v*w + 1));
+  for (unsigned i = 0; i < 4; ++i)
+    BOOST_CHECK_EQUAL(generators.llNormalForm(polys[i]),
+                      ll_red_nf(polys[i], generators.llReductor));
+}
+
+BOOST_AUTO_TEST_CASE(test_ll_substitution) {
+
+  LLReductor reductors(ring);
+  reductors.update(PolyEntry(z + v + w));
+  reductors.update(PolyEntry(y + v*w + 1));
+
+  BoolePolynomial polys[] = {x*y*v + z*w + x + y + v*w*x,
+                             x*y*z*v*w + x*z + y*w + 1, x, v*w + 1};
+  for (unsigned i = 0; i < 4; ++i) {
+    BOOST_CHECK_EQUAL(reductors.substitute(polys[i]),
+                      ll_red_nf(polys[i], reductors));
+    ring.clearCache();
+    BOOST_CHECK_EQUAL(reductors.substitute(polys[i]),
+                      ll_red_nf(polys[i], reductors));
+  }
+
+  // results are cached in the computed table, they are dropped with it
+  LLSubstitution substitution(reductors);
+  BOOST_CHECK_EQUAL(substitution(polys[1]), ll_red_nf(polys[1], reductors));
+  BOOST_CHECK(substitution.cached(polys[1]));
+  ring.clearCache();
+  BOOST_CHECK(!substitution.cached(polys[1]));
+  BOOST_CHECK_EQUAL(substitution(polys[1]), ll_red_nf(polys[1], reductors));
+
+  // table is recompiled after changes
+  reductors.update(PolyEntry(x + y*z));
+  for (unsigned i = 0; i < 4; ++i)
+    BOOST_CHECK_EQUAL(reductors.substitute(polys[i]),
+                      ll_red_nf(polys[i], reductors));
+
+  BoolePolynomial system[] = {x + y*z + 1, y + v*w, x*v + z*w + w + 1,
+                              z*v + x*w};
+  GroebnerStrategy plain(ring), table(ring);
+  plain.generators.optLL = table.generators.optLL = true;
+  table.generators.optLLTable = true;
+  for (unsigned i = 0; i < 4; ++i) {
+    plain.addGeneratorDelayed(system[i]);
+    table.addGeneratorDelayed(system[i]);
+  }
+  plain.symmGB_F2();
+  table.symmGB_F2();
+  BOOST_CHECK(plain.minimalizeAndTailReduce() ==
+              table.minimalizeAndTailReduce());
+}
+
+BOOST_AUTO_TEST_CASE(test_geobucket) {
+
+  BoolePolynomial front = x*y*z + x*v + y*w + z + 1;
+  BoolePolynomial summands[] = {x*y*z + x*w, x*v + x*w + v*w, y*w + 1,
+                                z*v*w + z, x*y*z + z*v*w + v*w + 1};
+  GeoBucket bucket(front);
+  BoolePolynomial sum = front;
+  for (unsigned i = 0; i < 5; ++i) {
+    bucket.add(summands[i], summands[i].length());
+    sum += summands[i];
+    BOOST_CHECK_EQUAL(bucket.isZero(), sum.isZero());
+    if (!sum.isZero())
+      BOOST_CHECK_EQUAL(bucket.lead(), sum.lead());
+  }
+  BOOST_CHECK_EQUAL(bucket.value(), sum);
+
+  bucket.reset(x + y);
+  bucket.add(x + y, 2);
+  BOOST_CHECK(bucket.isZero());
+  BOOST_CHECK(bucket.value().isZero());
+
+  // leading terms w.r.t. degree orderings using degree bounds
+  BoolePolyRing dring(5, COrderEnums::dlex);
+  BooleVariable a(0, dring), b(1, dring), c(2, dring), d(3, dring),
+    e(4, dring);
+  BoolePolynomial dfront = a*b*c + a*d + b*e + c + 1;
+  BoolePolynomial dsummands[] = {a*b*c + a*e, a*d + a*e + d*e, b*e + 1,
+                                 c*d*e + c, a*b*c + c*d*e + d*e + 1};
+  GeoBucket bounded(dfront, 3);
+  sum = dfront;
+  for (unsigned i = 0; i < 5; ++i) {
+    bounded.add(dsummands[i], dsummands[i].length(), 3);
+    sum += dsummands[i];
+    BOOST_CHECK_EQUAL(bounded.isZero(), sum.isZero());
+    if (!sum.isZero())
+      BOOST_CHECK_EQUAL(bounded.lead(), sum.lead());
+  }
+  BOOST_CHECK_EQUAL(bounded.value(), sum);
+}
+
+BOOST_AUTO_TEST_CASE(test_batch_red_tail) {
+
+  COrderEnums::ordercodes orders[] = {COrderEnums::lp, COrderEnums::dlex,
+                                      COrderEnums::dp_asc,
+                                      COrderEnums::block_dlex,
+                                      COrderEnums::block_dp_asc};
+  for (unsigned order = 0; order < 5; ++order) {
+    BoolePolyRing sring(10, orders[order]);
+    if (sring.ordering().isBlockOrder())
+      sring.ordering().appendBlock(5);
+
+    BooleVariable a(0, sring), b(1, sring), c(2, sring), d(3, sring),
+      e(4, sring), f(5, sring), g(6, sring), h(7, sring), i(8, sring),
+      j(9, sring);
+    // the products are leading terms of the last elements
+    BoolePolynomial shared = c*d + e*f + g*h + i*j;
+    BoolePolynomial system[] = {a*b + shared + 1, a + shared + e,
+                                b + shared + g, c*d + e + h*i, e*f + g + j,
+                                g*h + c + 1, i*j + a*c + d};
+    std::vector<BoolePolynomial> polys(system, system + 7);
+
+    // tails are left alone until the basis is tail reduced at once
+    GroebnerStrategy batch(sring);
+    batch.optBatchTailReduce = true;
+    batch.generators.optRedTail = false;
+    for (unsigned idx = 0; idx < polys.size(); ++idx)
+      batch.addGeneratorDelayed(polys[idx]);
+    batch.symmGB_F2();
+
+    // reducible tail terms are shared by several elements
+    std::vector<BoolePolynomial> unreduced = batch.minimalize();
+    MonomialSet reducible(sring);
+    bool shared_terms = false;
+    for (unsigned idx = 0; idx < unreduced.size(); ++idx) {
+      MonomialSet terms =
+        unreduced[idx].diagram().diff(unreduced[idx].lead().diagram());
+      terms = terms.diff(mod_mon_set(terms,
+                                     batch.generators.minimalLeadingTerms));
+      shared_terms = shared_terms || !terms.intersect(reducible).isZero();
+      reducible = reducible.unite(terms);
+    }
+    BOOST_CHECK(shared_terms);
+
+    check_reduced_basis(polys, batch.minimalizeAndTailReduce());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_reducer_selection) {
+
+  ReductionStrategy strat(ring);
+  strat.addGenerator(PolyEntry(x*y + z*v + w + v + 1));
+  BooleMonomial term = x*y*z;
+  BOOST_CHECK_EQUAL(strat.select1(term), 0);
+  BOOST_CHECK_EQUAL(strat.select1(term), 0);
+  BOOST_CHECK_EQUAL(strat.select_short(term), -1);
+  BOOST_CHECK_EQUAL(strat.select1(v*w), -1);
+
+  // new (shorter) reductors invalidate the selections
+  strat.addGenerator(PolyEntry(y*z + 1));
+  BOOST_CHECK_EQUAL(strat.select1(term), 1);
+  BOOST_CHECK_EQUAL(strat.select_short(term), 1);
+
+  // so do exchanged ones
+  strat.exchange(1, BoolePolynomial(y*z + z*v*w + v*w + v + w + 1));
+  BOOST_CHECK_EQUAL(strat.select1(term), 0);
+  BOOST_CHECK_EQUAL(strat.select_short(term), -1);
+}
+
+BOOST_AUTO_TEST_CASE(test_mod_mon_set) {
+
+  BooleSet terms = (x*y*z + x*v + y*w + z*v*w + x + w + 1).diagram();
+  BooleSet filters[] = {(x + w).diagram(), (x*v + z*w).diagram(),
+                        (y + x*z + v*w).diagram(), (x*y*z + v).diagram(),
+                        BooleSet(ring), BoolePolynomial(1, ring).diagram()};
+  for (unsigned i = 0; i < 6; ++i) {
+    BooleSet expected(ring);
+    for (BooleSet::const_iterator term = terms.begin(); term != terms.end();
+         ++term)
+      if (filters[i].intersect(term->divisors()).isZero())
+        expected = expected.unite(term->diagram());
+
+    BOOST_CHECK_EQUAL(mod_mon_set(terms, filters[i]), expected);
+  }
+  BOOST_CHECK_EQUAL(mod_var_set(terms, (y + v).diagram()),
+                    (x + w + 1).diagram());
+  BOOST_CHECK_EQUAL(mod_deg2_set(terms, (x*y + v*w).diagram()),
+                    (x*v + y*w + x + w + 1).diagram());
+
+  // larger sets with shared nodes
+  BoolePolynomial product(1, ring);
+  for (unsigned idx = 10; idx < 19; ++idx)
+    product *= BooleVariable(idx, ring) + 1;
+  terms = product.diagram();
+  BooleSet quadratic = (BooleVariable(10, ring)*BooleVariable(13, ring) +
+                        BooleVariable(12, ring)*BooleVariable(18, ring)
+                        ).diagram();
+  BooleSet filter = quadratic.unite(BooleVariable(15, ring).set());
+  BooleSet expected(ring), expected_quadratic(ring);
+  for (BooleSet::const_iterator term = terms.begin(); term != terms.end();
+       ++term) {
+    if (filter.intersect(term->divisors()).isZero())
+      expected = expected.unite(term->diagram());
+    if (quadratic.intersect(term->divisors()).isZero())
+      expected_quadratic = expected_quadratic.unite(term->diagram());
+  }
+  BOOST_CHECK_EQUAL(mod_mon_set(terms, filter), expected);
+  BOOST_CHECK_EQUAL(mod_deg2_set(terms, quadratic), expected_quadratic);
+}
+
+BOOST_AUTO_TEST_CASE(test_minimal_leading_terms) {
+
+  MinimalLeadingTerms leads(ring);
+  BooleMonomial updates[] = {x*y*z, v*w, x*v, x*y, y*z*w};
+  BooleMonomial queries[] = {x*y*z*v, x*y*w, v*w, y*z*w, x*z*w, z*v, x};
+  for (unsigned i = 0; i < 5; ++i) {
+    leads.update(updates[i]);
+    for (unsigned j = 0; j < 7; ++j) {
+      BOOST_CHECK_EQUAL(leads.containsDivisorOf(queries[j]),
+                        leads.hasTermOfVariables(queries[j]));
+      BOOST_CHECK_EQUAL(leads.containsDivisorOf(queries[j].exp()),
+                        leads.hasTermOfVariables(queries[j]));
+    }
+  }
+  // x*y*z was removed by x*y
+  BOOST_CHECK(!leads.owns(x*y*z));
+  BOOST_CHECK(leads.containsDivisorOf(x*y*z));
+}
+
+BOOST_AUTO_TEST_CASE(test_reduction_lanes) {
+
+  // (degree orderings reduce by linear algebra in their only block instead)
+  COrderEnums::ordercodes orders[] = {COrderEnums::lp,
+                                      COrderEnums::block_dlex,
+                                      COrderEnums::block_dp_asc};
+  for (unsigned order = 0; order < 3; ++order) {
+    BoolePolyRing sring(8, orders[order]);
+    if (sring.ordering().isBlockOrder())
+      sring.ordering().appendBlock(4);
+
+    // the rounds of parallel_reduce consist of two or three groups of equal
+    // leading terms with different (short) reductors
+    BooleVariable a(0, sring), b(1, sring), c(2, sring), d(3, sring),
+      e(4, sring), f(5, sring), g(6, sring), h(7, sring);
+    BoolePolynomial system[] = {a*b + c*d + e*g + h + 1, b*c + d*f + a*h + g,
+                                a*e + b*f + c*g + d + h, c*e*f + a*d + b + 1,
+                                d*g*h + e*f + a*c + 1, a*f*h + b*e + g};
+    std::vector<BoolePolynomial> polys(system, system + 6);
+
+    GroebnerStrategy lanes(sring);
+    lanes.reductionLanes = 4;
+    for (unsigned i = 0; i < polys.size(); ++i)
+      lanes.addGeneratorDelayed(polys[i]);
+    lanes.symmGB_F2();
+
+    check_reduced_basis(polys, lanes.minimalizeAndTailReduce());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_table_generator) {
+
+  // generated tables agree with the precomputed ones
+  COrderEnums::ordercodes orders[] = {COrderEnums::lp, COrderEnums::dlex,
+                                      COrderEnums::dp_asc};
+  for (unsigned order = 0; order < 3; ++order) {
+    BoolePolyRing sring(4, orders[order]);
+    Exponent used = (BooleVariable(0, sring) * BooleVariable(1, sring) *
+                     BooleVariable(2, sring) * BooleVariable(3, sring)).exp();
+    GroebnerTableGenerator generator(sring, used);
+    for (unsigned p_code = 1; p_code < (1u << 16); ++p_code) {
+      std::set<unsigned> expected, result;
+      for (int i = 0; get_table_entry4(sring, p_code, i) != 0; ++i)
+        expected.insert(get_table_entry4(sring, p_code, i));
+      for (const unsigned* codes = generator[p_code]; *codes != 0; ++codes)
+        result.insert(*codes);
+      BOOST_CHECK(result == expected);
+    }
+  }
+
+  // five variables in two blocks: the elements vanish on the zeros and there
+  // are as many standard monomials as zeros
+  BoolePolyRing bring(7, COrderEnums::block_dlex);
+  bring.ordering().appendBlock(3);
+  std::vector<idx_type> back_2_ring;
+  for (idx_type idx = 1; idx < 6; ++idx)
+    back_2_ring.push_back(idx);
+  Monomial used_m = code_2_m(bring, 31, back_2_ring);
+  MonomialSet terms = used_m.divisors();
+  GroebnerTableGenerators generators;
+  GroebnerTableGenerator& generator = generators(bring, used_m.exp());
+  BOOST_CHECK_EQUAL(&generators(bring, used_m.exp()), &generator);
+  BOOST_CHECK_EQUAL(generators.size(), 1);
+
+  unsigned p_code = 0x2a6b1f37;
+  for (unsigned step = 0; step < 200; ++step) {
+    p_code = p_code * 1103515245u + 12345u;
+    Polynomial p = code_2_poly(bring, p_code, back_2_ring);
+    MonomialSet points = zeros(p, terms);
+    MonomialSet leads(bring);
+    for (const unsigned* codes = generator[p_code]; *codes != 0; ++codes) {
+      Polynomial element = code_2_poly(bring, *codes, back_2_ring);
+      BOOST_CHECK(zeros(element, points) == points);
+      leads = leads.unite(element.lead().diagram());
+    }
+    BOOST_CHECK_EQUAL(mod_mon_set(terms, leads).size(), points.size());
+  }
+
+  // fast path for polynomials in several blocks: each element of the system
+  // uses all of the five variables, which are split into both blocks
+  COrderEnums::ordercodes block_orders[] = {COrderEnums::block_dlex,
+                                            COrderEnums::block_dp_asc};
+  for (unsigned order = 0; order < 2; ++order) {
+    BoolePolyRing sring(7, block_orders[order]);
+    sring.ordering().appendBlock(3);
+
+    BooleVariable a(1, sring), b(2, sring), c(3, sring), d(4, sring),
+      e(5, sring);
+    BoolePolynomial system[] = {a*c + b*d + e + a, b*c*e + a*d + c + b,
+                                a*b + c*d*e + d + 1};
+    std::vector<BoolePolynomial> polys(system, system + 3);
+
+    GroebnerStrategy tables(sring);
+    tables.optBlockTables = true;
+    for (unsigned i = 0; i < polys.size(); ++i)
+      tables.addGeneratorDelayed(polys[i]);
+    tables.symmGB_F2();
+    // generators are kept by the strategy (and shared by its copies)
+    BOOST_CHECK(tables.tableGenerators->size() > 0);
+    BOOST_CHECK(GroebnerStrategy(tables).tableGenerators ==
+                tables.tableGenerators);
+
+    check_reduced_basis(polys, tables.minimalizeAndTailReduce());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_binomial_nf) {
+
+  COrderEnums::ordercodes orders[] = {COrderEnums::lp, COrderEnums::dlex,
+                                      COrderEnums::dp_asc};
+  for (unsigned order = 0; order < 3; ++order) {
+    BoolePolyRing sring(8, orders[order]);
+    BooleVariable a(0, sring), b(1, sring), c(2, sring), d(3, sring),
+      e(4, sring), f(5, sring), g(6, sring), h(7, sring);
+    BoolePolynomial system[] = {a*b + a, c*g + g, e*h + 1, b*d + d,
+                                a*c + c, f + g, a*d*e + b*g + c};
+
+    GroebnerStrategy strat(sring);
+    for (unsigned i = 0; i < 7; ++i)
+      strat.addGeneratorDelayed(system[i]);
+    strat.symmGB_F2();
+    const BinomialReductors& binomials = strat.generators.binomials;
+    BOOST_CHECK(!binomials.plusOne().isZero());
+    BOOST_CHECK(!binomials.keptFirst().isZero());
+    BOOST_CHECK(!binomials.keptSecond().isZero());
+
+    BooleMonomial all = a*b*c*d*e*f*g*h;
+    BooleSet points = all.divisors(), vanishing = points;
+    for (unsigned i = 0; i < 7; ++i)
+      vanishing = zeros(system[i], vanishing);
+
+    BoolePolynomial samples[] = {a*b*c*d + e*f*g + h, b*c*e*g*h + a*f + 1,
+                                 a*c*g + d*f*h*b + c + e,
+                                 a*b*c*d*e*f*g*h + a*b*e + g};
+    for (unsigned i = 0; i < 4; ++i) {
+      BoolePolynomial result = binomial_nf(strat.generators, samples[i]);
+      // congruent on the common zeros and irreducible by the binomials
+      BOOST_CHECK(zeros(result + samples[i], vanishing) == vanishing);
+      BOOST_CHECK(mod_mon_set(result.diagram(), binomials.plusOne()) ==
+                  result.diagram());
+      BOOST_CHECK(mod_mon_set(result.diagram(), binomials.keptFirst()) ==
+                  result.diagram());
+      BOOST_CHECK(mod_mon_set(result.diagram(), binomials.keptSecond()) ==
+                  result.diagram());
+    }
+
+    std::vector<BoolePolynomial> basis = strat.minimalizeAndTailReduce();
+    BooleSet basis_zeros = points;
+    for (unsigned i = 0; i < basis.size(); ++i)
+      basis_zeros = zeros(basis[i], basis_zeros);
+    BOOST_CHECK(basis_zeros == vanishing);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_signature_strategy) {
+
+  COrderEnums::ordercodes orders[] = {COrderEnums::lp, COrderEnums::dlex,
+                                      COrderEnums::dp_asc,
+                                      COrderEnums::block_dlex,
+                                      COrderEnums::block_dp_asc};
+  for (unsigned order = 0; order < 5; ++order) {
+    BoolePolyRing sring(6, orders[order]);
+    if (sring.ordering().isBlockOrder())
+      sring.ordering().appendBlock(3);
+
+    // extension of the ordering coincides with the ordering itself
+    SignatureTermOrder term_order(sring);
+    BooleSet terms = (BooleVariable(0, sring) + 1) * (BooleVariable(1, sring) + 1) *
+      (BooleVariable(3, sring) + 1) * (BooleVariable(5, sring) + 1);
+    for (BooleSet::exp_iterator lhs = terms.expBegin();
+         lhs != terms.expEnd(); ++lhs)
+      for (BooleSet::exp_iterator rhs = terms.expBegin();
+           rhs != terms.expEnd(); ++rhs)
+        BOOST_CHECK_EQUAL(term_order.compare(*lhs, *rhs),
+                          sring.ordering().compare(*lhs, *rhs));
+
+    BooleVariable a(0, sring), b(1, sring), c(2, sring), d(3, sring),
+      e(4, sring), f(5, sring);
+    BoolePolynomial system[] = {a*b + c*d + e + 1, b*c + d*f + a,
+                                a*e + b*f + c + d, c*e*f + a*d + b + 1};
+    std::vector<BoolePolynomial> polys(system, system + 4);
+
+    SignatureStrategy sigstrat(sring);
+    for (unsigned i = 0; i < polys.size(); ++i)
+      sigstrat.addGenerator(polys[i]);
+
+    check_reduced_basis(polys, sigstrat.minimalizeAndTailReduce());
+
+    // the criteria discard pairs, which would reduce to zero otherwise
+    BOOST_CHECK(sigstrat.avoidedZeroReductions() > 0);
+    BOOST_CHECK_EQUAL(sigstrat.avoidedZeroReductions(),
+                      sigstrat.syzygyCriterions + sigstrat.rewriteCriterions);
+    BOOST_CHECK(sigstrat.reductionSteps > 0);
+  }
+
+  // counters of a run traced by hand: for x*y + z the pairs of signatures
+  // y, y*z, x and x*z (in this order) are reduced in one step each, the
+  // second and fourth one to zero, and both J-pairs have the syzygy
+  // signature x*y of the Boolean syzygy
+  SignatureStrategy traced(ring);
+  traced.addGenerator(x*y + z);
+  BOOST_CHECK_EQUAL(traced.reductionSteps, 4u);
+  BOOST_CHECK_EQUAL(traced.zeroReductions, 2u);
+  BOOST_CHECK_EQUAL(traced.syzygyCriterions, 2u);
+  BOOST_CHECK_EQUAL(traced.rewriteCriterions, 0u);
+  BOOST_CHECK_EQUAL(traced.avoidedZeroReductions(), 2u);
+
+  // a generator in the ideal reduces to zero by the previous basis only
+  traced.addGenerator(x*z + z);
+  BOOST_CHECK_EQUAL(traced.reductionSteps, 4u);
+  BOOST_CHECK_EQUAL(traced.zeroReductions, 3u);
+  BOOST_CHECK_EQUAL(traced.avoidedZeroReductions(), 2u);
+
+  // inconsistent systems
+  SignatureStrategy sigstrat(ring);
+  sigstrat.addGenerator(x*y + 1);
+  sigstrat.addGenerator(x + z);
+  sigstrat.addGenerator(z*y);
+  BOOST_CHECK(sigstrat.containsOne());
+  BOOST_CHECK_EQUAL(sigstrat.minimalize().size(), 1u);
+  BOOST_CHECK(sigstrat.minimalize()[0].isOne());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
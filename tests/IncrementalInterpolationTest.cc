@@ -0,0 +1,103 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file IncrementalInterpolationTest.cc
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-19
+ *
+ * boost/test-driven unit test
+ * 
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+ **/
+//*****************************************************************************
+
+
+#include <boost/test/unit_test.hpp>
+#include <boost/version.hpp>
+#if BOOST_VERSION < 107100
+#include <boost/test/output_test_stream.hpp>
+#else
+#include <boost/test/tools/output_test_stream.hpp>
+#endif
+
+using boost::test_tools::output_test_stream;
+
+#include <polybori/groebner/IncrementalInterpolation.h>
+#include <polybori/groebner/interpolate.h>
+#include <stdexcept>
+#include <vector>
+
+USING_NAMESPACE_PBORI
+USING_NAMESPACE_PBORIGB
+
+struct Fincremental {
+  Fincremental() { BOOST_TEST_MESSAGE( "setup fixture" ); }
+  ~Fincremental() { BOOST_TEST_MESSAGE( "teardown fixture" ); }
+};
+
+BOOST_FIXTURE_TEST_SUITE(IncrementalInterpolationTestSuite, Fincremental )
+
+BOOST_AUTO_TEST_CASE(test_incremental_interpolation) {
+
+  BoolePolyRing sring(6, COrderEnums::lp);
+  BooleMonomial all = sring.variable(0) * sring.variable(1) *
+    sring.variable(2) * sring.variable(3) * sring.variable(4) *
+    sring.variable(5);
+  BoolePolynomial func = sring.variable(0) * sring.variable(3) +
+    sring.variable(1) * sring.variable(2) * sring.variable(5) +
+    sring.variable(4);
+
+  std::vector<BooleMonomial> candidates(all.divisors().begin(),
+                                        all.divisors().end());
+  IncrementalInterpolation interpolation(all);
+  BooleSet to_zero(sring), to_one(sring);
+  unsigned seed = 17;
+  for (unsigned chunk = 0; chunk < 4; ++chunk) {
+    std::vector<BooleExponent> zero_exps, one_exps;
+    for (unsigned i = 0; i < 12; ++i) {
+      seed = seed * 1103515245u + 12345u;
+      BooleMonomial point = candidates[(seed >> 16) % candidates.size()];
+      BooleSet single = point.set();
+      if (zeros(func, single).isZero()) {
+        one_exps.push_back(point.exp());
+        to_one = to_one.unite(single);
+      }
+      else {
+        zero_exps.push_back(point.exp());
+        to_zero = to_zero.unite(single);
+      }
+    }
+    // staircases kept from the last update do not depend on the cache
+    if (chunk == 2)
+      sring.clearCache();
+    interpolation.addZeros(zero_exps);
+    interpolation.addOnes(one_exps);
+
+    BooleSet points = to_zero.unite(to_one);
+    BOOST_CHECK(interpolation.toZero() == to_zero);
+    BOOST_CHECK(interpolation.toOne() == to_one);
+    BOOST_CHECK(interpolation.standardMonomials() ==
+                variety_lex_standard_monomials(points));
+    BOOST_CHECK_EQUAL(interpolation.standardMonomials().size(),
+                      points.size());
+    BOOST_CHECK(interpolation.leadingTerms() ==
+                variety_lex_leading_terms(points, all));
+    BOOST_CHECK_EQUAL(interpolation.interpolation(),
+                      interpolate_smallest_lex(to_zero, to_one));
+
+    std::vector<BoolePolynomial> basis = interpolation.groebnerBasis();
+    std::vector<BoolePolynomial> expected =
+      variety_lex_groebner_basis(points, all);
+    BOOST_CHECK_EQUAL(basis.size(), expected.size());
+    for (unsigned i = 0; (i < basis.size()) && (i < expected.size()); ++i) {
+      BOOST_CHECK_EQUAL(basis[i], expected[i]);
+      BOOST_CHECK(zeros(basis[i], points) == points);
+    }
+  }
+  BOOST_CHECK_THROW(interpolation.addOnes(interpolation.toZero()),
+                    std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,88 @@
+// -*- c++ -*-
+//*****************************************************************************
+/** @file TermIterBenchmark.cc
+ *
+ * @author The PolyBoRi Team
+ * @date 2026-10-18
+ *
+ * Benchmark for iterating the terms of a polynomial w.r.t. the orderings,
+ * materializing exponents, using views of the terms, and copying iterators.
+ *
+ * Usage: TermIterBenchmark [number of factors (default: 13, i.e. 3^13 terms)]
+ *
+ * @par Copyright:
+ *   (c) 2006-2026 by The PolyBoRi Team
+ *
+ **/
+//*****************************************************************************
+
+#include <polybori.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+USING_NAMESPACE_PBORI
+
+static double
+seconds_since(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start).count();
+}
+
+int
+main(int argc, char** argv) {
+
+  const unsigned nfactors = (argc > 1? std::strtoul(argv[1], NULL, 10): 13);
+  const unsigned nvars = 3 * nfactors;
+
+  const char* names[] = {"lp", "dlex", "dp_asc", "block_dlex",
+                         "block_dp_asc"};
+  COrderEnums::ordercodes orders[] = {COrderEnums::lp, COrderEnums::dlex,
+                                      COrderEnums::dp_asc,
+                                      COrderEnums::block_dlex,
+                                      COrderEnums::block_dp_asc};
+  for (unsigned order = 0; order < 5; ++order) {
+    BoolePolyRing ring(nvars, orders[order]);
+    if (orders[order] == COrderEnums::block_dlex ||
+        orders[order] == COrderEnums::block_dp_asc) {
+      ring.ordering().appendBlock(nvars / 3);
+      ring.ordering().appendBlock(2 * nvars / 3);
+    }
+
+    // product of factors with three terms each (of different degrees)
+    BoolePolynomial poly(1, ring);
+    for (unsigned idx = 0; idx < nfactors; ++idx)
+      poly *= BooleVariable(3 * idx, ring) +
+        BooleVariable(3 * idx + 1, ring) * BooleVariable(3 * idx + 2, ring) +
+        1;
+
+    std::size_t exp_sum = 0, view_sum = 0, nterms = 0;
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    for (BoolePolynomial::ordered_exp_iterator iter(poly.orderedExpBegin()),
+           finish(poly.orderedExpEnd()); iter != finish; ++iter)
+      exp_sum += (*iter).size();
+    double exp_time = seconds_since(start);
+
+    start = std::chrono::steady_clock::now();
+    for (BoolePolynomial::ordered_exp_iterator iter(poly.orderedExpBegin()),
+           finish(poly.orderedExpEnd()); iter != finish; ++iter)
+      view_sum += iter.view().size();
+    double view_time = seconds_since(start);
+
+    start = std::chrono::steady_clock::now();
+    for (BoolePolynomial::ordered_exp_iterator iter(poly.orderedExpBegin()),
+           finish(poly.orderedExpEnd()); iter != finish; ) {
+      BoolePolynomial::ordered_exp_iterator previous(iter++);
+      nterms += (previous != iter);
+    }
+    double copy_time = seconds_since(start);
+
+    std::cout << names[order] << " (" << nterms << " terms): exponents "
+              << exp_time << "s, views " << view_time << "s, copies "
+              << copy_time << "s"
+              << (exp_sum == view_sum? "": " (MISMATCH)") << std::endl;
+  }
+  return 0;
+}